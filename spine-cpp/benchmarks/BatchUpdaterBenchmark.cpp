@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+
+#include <spine/SkeletonBatchUpdater.h>
+
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+using namespace spine;
+
+SpineExtension *spine::getDefaultExtension() {
+	return new DefaultSpineExtension();
+}
+
+/// Updates many animated skeletons with SkeletonBatchUpdater using an increasing number of worker threads and prints
+/// the time per update relative to updating them all on the calling thread.
+/// Usage: spine-cpp-batch-benchmark [examples directory] [number of skeletons]
+int main(int argc, char **argv) {
+	BenchmarkSkeleton spineboy(argc, argv, "spineboy", "spineboy-pro.skel");
+	BenchmarkSkeleton raptor(argc, argv, "raptor", "raptor-pro.skel");
+	if (!spineboy.getData() || !raptor.getData()) return 1;
+	int numSkeletons = argc > 2 ? atoi(argv[2]) : 1000;
+	const int numUpdates = 200;
+
+	AnimationStateData spineboyStateData(spineboy.getData());
+	AnimationStateData raptorStateData(raptor.getData());
+	std::vector<Skeleton *> skeletons;
+	std::vector<AnimationState *> states;
+	for (int i = 0; i < numSkeletons; i++) {
+		bool isSpineboy = i % 2 == 0;
+		Skeleton *skeleton = new Skeleton(isSpineboy ? spineboy.getData() : raptor.getData());
+		AnimationState *state = new AnimationState(isSpineboy ? &spineboyStateData : &raptorStateData);
+		state->setAnimation(0, isSpineboy ? "run" : "walk", true);
+		// Spread the skeletons over the animation, so they don't all hit the same keys.
+		state->update(i * 0.01f);
+		skeletons.push_back(skeleton);
+		states.push_back(state);
+	}
+
+	int hardwareThreads = (int) std::thread::hardware_concurrency();
+	if (hardwareThreads < 1) hardwareThreads = 1;
+	printf("%d skeletons, %d updates, %d hardware threads\n", numSkeletons, numUpdates, hardwareThreads);
+	// Powers of 2 up to all hardware threads.
+	std::vector<int> threadCounts;
+	for (int threads = 1; threads < hardwareThreads; threads *= 2) threadCounts.push_back(threads);
+	threadCounts.push_back(hardwareThreads);
+
+	double singleThreaded = 0;
+	for (size_t t = 0; t < threadCounts.size(); t++) {
+		int threads = threadCounts[t];
+		SkeletonBatchUpdater updater(threads - 1);
+		for (int i = 0; i < numSkeletons; i++) updater.add(skeletons[i], states[i]);
+		for (int i = 0; i < 10; i++) updater.update(1 / 60.0f, Physics_Update);
+		BenchmarkTimer timer;
+		for (int i = 0; i < numUpdates; i++) updater.update(1 / 60.0f, Physics_Update);
+		double millis = timer.getMillis() / numUpdates;
+		if (threads == 1) singleThreaded = millis;
+		printf("%2d threads: %7.3f ms per update, %5.2fx\n", threads, millis, singleThreaded / millis);
+	}
+
+	for (int i = 0; i < numSkeletons; i++) {
+		delete states[i];
+		delete skeletons[i];
+	}
+	return 0;
+}
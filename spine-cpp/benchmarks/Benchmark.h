@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_Benchmark_h
+#define Spine_Benchmark_h
+
+#include <spine/spine.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <string>
+
+namespace spine {
+	/// Atlas pages are not loaded, the benchmarks never render.
+	class BenchmarkTextureLoader : public TextureLoader {
+	public:
+		void load(AtlasPage &page, const String &path) {
+			page.texture = (void *) 1;
+			page.width = 1024;
+			page.height = 1024;
+		}
+
+		void unload(void *texture) {
+		}
+	};
+
+	/// An example skeleton loaded from the examples directory, which is the first argument of a benchmark or
+	/// SPINE_EXAMPLES_DIR.
+	class BenchmarkSkeleton {
+	public:
+		BenchmarkSkeleton(int argc, char **argv, const char *name, const char *skeletonFile) : _atlas(NULL), _data(NULL) {
+			std::string dir = std::string(argc > 1 ? argv[1] : SPINE_EXAMPLES_DIR) + "/" + name + "/export/";
+			_atlas = new Atlas((dir + name + ".atlas").c_str(), &_textureLoader);
+			if (_atlas->getPages().size() == 0) {
+				delete _atlas;
+				_atlas = new Atlas((dir + name + "-pma.atlas").c_str(), &_textureLoader);
+			}
+			_path = dir + skeletonFile;
+			SkeletonBinary binary(_atlas);
+			_data = binary.readSkeletonDataFile(_path.c_str());
+			if (!_data) printf("Couldn't load %s: %s\n", _path.c_str(), binary.getError().buffer());
+		}
+
+		~BenchmarkSkeleton() {
+			delete _data;
+			delete _atlas;
+		}
+
+		Atlas *getAtlas() { return _atlas; }
+
+		SkeletonData *getData() { return _data; }
+
+		const std::string &getPath() { return _path; }
+
+	private:
+		BenchmarkTextureLoader _textureLoader;
+		Atlas *_atlas;
+		SkeletonData *_data;
+		std::string _path;
+	};
+
+	/// Milliseconds since the timer was created.
+	class BenchmarkTimer {
+	public:
+		BenchmarkTimer() : _start(std::chrono::steady_clock::now()) {
+		}
+
+		double getMillis() {
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+		}
+
+	private:
+		std::chrono::steady_clock::time_point _start;
+	};
+}
+
+#endif /* Spine_Benchmark_h */
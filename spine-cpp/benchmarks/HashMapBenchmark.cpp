@@ -0,0 +1,190 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include "Benchmark.h"
+
+#include <stdlib.h>
+
+using namespace spine;
+
+SpineExtension *spine::getDefaultExtension() {
+	return new DefaultSpineExtension();
+}
+
+/// The HashMap of spine-cpp 4.2, a doubly linked list with a linear search, used as the baseline.
+template<typename K, typename V>
+class LinkedListHashMap : public SpineObject {
+public:
+	LinkedListHashMap() : _head(NULL), _size(0) {
+	}
+
+	~LinkedListHashMap() {
+		clear();
+	}
+
+	void clear() {
+		for (Entry *entry = _head; entry != NULL;) {
+			Entry *next = entry->next;
+			delete entry;
+			entry = next;
+		}
+		_head = NULL;
+		_size = 0;
+	}
+
+	size_t size() {
+		return _size;
+	}
+
+	void put(const K &key, const V &value) {
+		Entry *entry = find(key);
+		if (entry) {
+			entry->_key = key;
+			entry->_value = value;
+		} else {
+			entry = new (__FILE__, __LINE__) Entry();
+			entry->_key = key;
+			entry->_value = value;
+
+			Entry *oldHead = _head;
+
+			if (oldHead) {
+				_head = entry;
+				oldHead->prev = entry;
+				entry->next = oldHead;
+			} else {
+				_head = entry;
+			}
+			_size++;
+		}
+	}
+
+	bool containsKey(const K &key) {
+		return find(key) != NULL;
+	}
+
+	bool remove(const K &key) {
+		Entry *entry = find(key);
+		if (!entry) return false;
+
+		Entry *prev = entry->prev;
+		Entry *next = entry->next;
+
+		if (prev) prev->next = next;
+		else _head = next;
+		if (next) next->prev = entry->prev;
+
+		delete entry;
+		_size--;
+
+		return true;
+	}
+
+private:
+	class Entry : public SpineObject {
+	public:
+		K _key;
+		V _value;
+		Entry *next;
+		Entry *prev;
+
+		Entry() : next(NULL), prev(NULL) {}
+	};
+
+	Entry *find(const K &key) {
+		for (Entry *entry = _head; entry != NULL; entry = entry->next) {
+			if (entry->_key == key)
+				return entry;
+		}
+		return NULL;
+	}
+
+	Entry *_head;
+	size_t _size;
+};
+
+/// Fills the map with the keys, looks up every key and a missing key for each, then removes all keys. Returns the
+/// milliseconds per round.
+template<typename Map, typename K>
+double benchmark(Vector<K> &keys, Vector<K> &missingKeys, int rounds, size_t &found) {
+	Map map;
+	BenchmarkTimer timer;
+	for (int round = 0; round < rounds; round++) {
+		for (size_t i = 0, n = keys.size(); i < n; i++)
+			map.put(keys[i], (int) i);
+		for (size_t i = 0, n = keys.size(); i < n; i++) {
+			if (map.containsKey(keys[i])) found++;
+			if (map.containsKey(missingKeys[i])) found++;
+		}
+		for (size_t i = 0, n = keys.size(); i < n; i++)
+			map.remove(keys[i]);
+	}
+	return timer.getMillis() / rounds;
+}
+
+template<typename K>
+void compare(const char *name, Vector<K> &keys, Vector<K> &missingKeys) {
+	// About the same number of operations for each size, with fewer rounds for the quadratic baseline.
+	int rounds = (int) (20000000 / (keys.size() * keys.size() + 1000)) + 1;
+	size_t found = 0;
+	double baseline = benchmark<LinkedListHashMap<K, int> >(keys, missingKeys, rounds, found);
+	double hashMap = benchmark<HashMap<K, int> >(keys, missingKeys, rounds, found);
+	printf("%-12s %6d keys: %10.4f ms, linked list %10.4f ms, %7.1fx\n", name, (int) keys.size(), hashMap, baseline,
+		   baseline / hashMap);
+	// Every key is found once per round and map, missing keys never.
+	if (found != keys.size() * rounds * 2) printf("Wrong number of keys found: %d\n", (int) found);
+}
+
+/// Compares HashMap to the linked list it replaced, for property ID keys as used by AnimationStateData and timelines,
+/// and for string keys as used for names.
+/// Usage: spine-cpp-hashmap-benchmark
+int main() {
+	size_t sizes[] = {4, 16, 64, 256, 1024, 4096};
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		Vector<long long> keys, missingKeys;
+		for (size_t i = 0; i < sizes[s]; i++) {
+			// Property IDs combine a property type in the high bits with a bone or slot index.
+			keys.add(((long long) (i % 20) << 32) | (long long) (i / 20));
+			missingKeys.add(((long long) (i % 20 + 20) << 32) | (long long) (i / 20));
+		}
+		compare("property ID", keys, missingKeys);
+	}
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		Vector<String> keys, missingKeys;
+		char name[32];
+		for (size_t i = 0; i < sizes[s]; i++) {
+			snprintf(name, sizeof(name), "attachment-%d", (int) i);
+			keys.add(String(name));
+			snprintf(name, sizeof(name), "attachment-%d-missing", (int) i);
+			missingKeys.add(String(name));
+		}
+		compare("string", keys, missingKeys);
+	}
+	return 0;
+}
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_SkeletonBatchUpdater_h
+#define Spine_SkeletonBatchUpdater_h
+
+#include <spine/Vector.h>
+#include <spine/Physics.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+	class Skeleton;
+
+	class AnimationState;
+
+	class SkeletonBatchWorkers;
+
+	/// Updates many independent skeletons and animation states using a pool of worker threads.
+	///
+	/// Each entry is updated like a single skeleton would be: AnimationState::update(), AnimationState::apply(),
+	/// Skeleton::update() and Skeleton::updateWorldTransform(). Entries are claimed by threads in small chunks, so threads
+	/// that finish early take over the remaining work of slower threads.
+	///
+	/// While entries are updated, the event queue of each animation state is disabled. Once all entries are updated, the
+	/// queued events are drained on the calling thread in the order the entries were added, so listeners never run on a
+	/// worker thread. Listeners see the events one update later than with AnimationState::update() and
+	/// AnimationState::apply() called directly, eg changes made in a complete listener take effect on the next update.
+	/// Animation states with an event buffer, see AnimationState::setEventBuffer(), instead drain their events into the
+	/// buffer on the worker thread.
+	///
+	/// Skeletons and animation states may share SkeletonData and AnimationStateData, but an entry's skeleton and animation
+	/// state must not be used by any other entry. Timeline::setSearchCache() must not be enabled for shared animations.
+	///
+	/// SkeletonBatchUpdater is part of the spine-cpp-batch library, which links threads.
+	class SP_API SkeletonBatchUpdater : public SpineObject {
+	public:
+		/// @param numThreads The number of worker threads to start in addition to the calling thread. If < 0, one less than
+		/// the number of hardware threads is used. If 0, all entries are updated on the calling thread.
+		explicit SkeletonBatchUpdater(int numThreads = -1);
+
+		~SkeletonBatchUpdater();
+
+		/// Adds a skeleton to be updated.
+		/// @param state May be NULL to only update the skeleton's physics and world transform.
+		void add(Skeleton *skeleton, AnimationState *state);
+
+		/// Removes the entry for the skeleton, if any.
+		void remove(Skeleton *skeleton);
+
+		void clear();
+
+		size_t size();
+
+		/// Updates all entries in parallel, then drains the event queues of their animation states on the calling thread.
+		void update(float delta, Physics physics);
+
+		/// The number of worker threads, not including the calling thread.
+		int getNumThreads();
+
+		/// The number of entries a thread claims at a time. Default is 16.
+		int getChunkSize();
+
+		void setChunkSize(int chunkSize);
+
+	private:
+		Vector<Skeleton *> _skeletons;
+		Vector<AnimationState *> _states;
+		SkeletonBatchWorkers *_workers;
+		int _chunkSize;
+		float _delta;
+		Physics _physics;
+
+		void updateEntries(size_t start, size_t end);
+
+		static void work(void *updater, size_t start, size_t end);
+	};
+}
+
+#endif /* Spine_SkeletonBatchUpdater_h */
@@ -0,0 +1,215 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/SkeletonBatchUpdater.h>
+
+#include <spine/AnimationState.h>
+#include <spine/Extension.h>
+#include <spine/Skeleton.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace spine {
+	class SkeletonBatchWorkers : public SpineObject {
+	public:
+		typedef void (*Task)(void *data, size_t start, size_t end);
+
+		explicit SkeletonBatchWorkers(int numThreads) : _generation(0), _busy(0), _quit(false), _task(NULL), _data(NULL),
+														_count(0), _chunkSize(1), _next(0) {
+			for (int i = 0; i < numThreads; i++) {
+				std::thread *thread = SpineExtension::alloc<std::thread>(1, __FILE__, __LINE__);
+				new (thread) std::thread(&SkeletonBatchWorkers::loop, this);
+				_threads.add(thread);
+			}
+		}
+
+		~SkeletonBatchWorkers() {
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_quit = true;
+			}
+			_start.notify_all();
+			for (size_t i = 0; i < _threads.size(); i++) {
+				_threads[i]->join();
+				_threads[i]->~thread();
+				SpineExtension::free(_threads[i], __FILE__, __LINE__);
+			}
+		}
+
+		int getNumThreads() {
+			return (int) _threads.size();
+		}
+
+		/// Calls task for all chunks of [0, count) using the worker threads and the calling thread, and returns when all
+		/// chunks are done.
+		void run(Task task, void *data, size_t count, size_t chunkSize) {
+			if (_threads.size() == 0 || count <= chunkSize) {
+				task(data, 0, count);
+				return;
+			}
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_task = task;
+				_data = data;
+				_count = count;
+				_chunkSize = chunkSize;
+				_next.store(0);
+				_busy = (int) _threads.size();
+				_generation++;
+			}
+			_start.notify_all();
+			runChunks();
+			std::unique_lock<std::mutex> lock(_mutex);
+			while (_busy > 0) _done.wait(lock);
+		}
+
+	private:
+		Vector<std::thread *> _threads;
+		std::mutex _mutex;
+		std::condition_variable _start, _done;
+		unsigned int _generation;
+		int _busy;
+		bool _quit;
+		Task _task;
+		void *_data;
+		size_t _count, _chunkSize;
+		std::atomic<size_t> _next;
+
+		void loop() {
+			unsigned int generation = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					while (!_quit && _generation == generation) _start.wait(lock);
+					if (_quit) return;
+					generation = _generation;
+				}
+				runChunks();
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (--_busy == 0) _done.notify_one();
+			}
+		}
+
+		void runChunks() {
+			while (true) {
+				size_t start = _next.fetch_add(_chunkSize);
+				if (start >= _count) return;
+				size_t end = start + _chunkSize;
+				_task(_data, start, end < _count ? end : _count);
+			}
+		}
+	};
+}
+
+using namespace spine;
+
+SkeletonBatchUpdater::SkeletonBatchUpdater(int numThreads) : _workers(NULL), _chunkSize(16), _delta(0),
+															 _physics(Physics_None) {
+	// Create the extension before any worker thread could lazily do so.
+	SpineExtension::getInstance();
+	if (numThreads < 0) {
+		numThreads = (int) std::thread::hardware_concurrency() - 1;
+		if (numThreads < 0) numThreads = 0;
+	}
+	_workers = new (__FILE__, __LINE__) SkeletonBatchWorkers(numThreads);
+}
+
+SkeletonBatchUpdater::~SkeletonBatchUpdater() {
+	delete _workers;
+}
+
+void SkeletonBatchUpdater::add(Skeleton *skeleton, AnimationState *state) {
+	assert(skeleton != NULL);
+	_skeletons.add(skeleton);
+	_states.add(state);
+}
+
+void SkeletonBatchUpdater::remove(Skeleton *skeleton) {
+	int index = _skeletons.indexOf(skeleton);
+	if (index < 0) return;
+	_skeletons.removeAt(index);
+	_states.removeAt(index);
+}
+
+void SkeletonBatchUpdater::clear() {
+	_skeletons.clear();
+	_states.clear();
+}
+
+size_t SkeletonBatchUpdater::size() {
+	return _skeletons.size();
+}
+
+void SkeletonBatchUpdater::update(float delta, Physics physics) {
+	_delta = delta;
+	_physics = physics;
+	_workers->run(work, this, _skeletons.size(), _chunkSize);
+
+	for (size_t i = 0, n = _states.size(); i < n; i++) {
+		AnimationState *state = _states[i];
+		if (!state || state->getEventBuffer()) continue;
+		state->enableQueue();
+		state->drainQueue();
+	}
+}
+
+int SkeletonBatchUpdater::getNumThreads() {
+	return _workers->getNumThreads();
+}
+
+int SkeletonBatchUpdater::getChunkSize() {
+	return _chunkSize;
+}
+
+void SkeletonBatchUpdater::setChunkSize(int chunkSize) {
+	_chunkSize = chunkSize < 1 ? 1 : chunkSize;
+}
+
+void SkeletonBatchUpdater::updateEntries(size_t start, size_t end) {
+	for (size_t i = start; i < end; i++) {
+		Skeleton *skeleton = _skeletons[i];
+		AnimationState *state = _states[i];
+		if (state) {
+			// Events added to an event buffer run no callbacks, so they are drained on the worker thread.
+			if (!state->getEventBuffer()) state->disableQueue();
+			state->update(_delta);
+			state->apply(*skeleton);
+		}
+		skeleton->update(_delta);
+		skeleton->updateWorldTransform(_physics);
+	}
+}
+
+void SkeletonBatchUpdater::work(void *updater, size_t start, size_t end) {
+	((SkeletonBatchUpdater *) updater)->updateEntries(start, end);
+}
@@ -50,6 +50,8 @@ namespace spine {
 	class SP_API Animation : public SpineObject {
 		friend class AnimationState;
 
+		friend class SkeletonData;
+
 		friend class TrackEntry;
 
 		friend class AnimationStateData;
@@ -120,9 +122,27 @@ namespace spine {
 		static int search(Vector<float> &values, float target);
 
 		static int search(Vector<float> &values, float target, int step);
+
+		/// Like search(Vector<float>&, float, int), but first checks the frame at hint and the frame after it, so
+		/// searching is O(1) when the time moves forward by less than a frame between calls. The result is stored in hint.
+		/// @param hint A frame index returned by a previous search of the same values, or -1.
+		static int search(Vector<float> &values, float target, int step, int &hint);
+
+		/// Enables or disables the search cache of all the animation's timelines. See Timeline::setSearchCache(bool).
+		void setSearchCache(bool searchCache);
 	private:
 		Vector<Timeline *> _timelines;
 		HashMap<PropertyId, bool> _timelineIds;
+		Vector<unsigned int> _propertySlotBits;
+		bool _propertySlotsBound;
+		/// The index in SkeletonData::getAnimations() if loaded with SkeletonBinary::setLazyAnimations(), else -1.
+		int _index;
+
+		void setTimelines(Vector<Timeline *> &timelines);
+
+		/// Returns true if any of the property slots is keyed, once SkeletonData::bindPropertySlots() was called.
+		bool hasPropertySlots(Vector<int> &slots);
+
 		float _duration;
 		String _name;
 	};
@@ -65,10 +65,14 @@ namespace spine {
 
 	class Skeleton;
 
+	class Timeline;
+
 	class RotateTimeline;
 
 	class AttachmentTimeline;
 
+	class EventBuffer;
+
 #ifdef SPINE_USE_STD_FUNCTION
 	typedef std::function<void (AnimationState* state, EventType type, TrackEntry* entry, Event* event)> AnimationStateListener;
 #else
@@ -372,6 +376,9 @@ namespace spine {
 
 		/// Poses the skeleton using the track entry animations. There are no side effects other than invoking listeners, so the
 		/// animation state can be applied to multiple skeletons to pose them identically.
+		///
+		/// If the skeleton is dormant, see Skeleton::setDormant(), only event timelines are applied: events and track entry
+		/// callbacks are raised as usual but the skeleton is not posed.
 		bool apply(Skeleton &skeleton);
 
 		/// Removes all animations from all tracks, leaving skeletons in their previous pose.
@@ -394,6 +401,9 @@ namespace spine {
 		/// @return
 		/// A track entry to allow further customization of animation playback. References to the track entry must not be kept
 		/// after AnimationState.Dispose.
+		///
+		/// An animation loaded with SkeletonBinary::setLazyAnimations() is decoded here, which changes the skeleton data
+		/// unless it is frozen, see SkeletonData::decodeAnimation(). addAnimation() does the same.
 		TrackEntry *setAnimation(size_t trackIndex, Animation *animation, bool loop);
 
 		/// Queues an animation by name.
@@ -443,10 +453,21 @@ namespace spine {
 
 		void setListener(AnimationStateListenerObject *listener);
 
+		/// When not NULL, events are added to the buffer instead of being passed to the listeners of the animation state
+		/// and its track entries. Draining the queue then runs no callbacks, so the animation state can be updated on any
+		/// thread and its events drained in bulk later. The buffer is not owned by the animation state and must not be
+		/// shared by animation states updated on different threads. Default is NULL.
+		void setEventBuffer(EventBuffer *buffer);
+
+		EventBuffer *getEventBuffer();
+
 		void disableQueue();
 
 		void enableQueue();
 
+		/// Raises all events queued while the queue was disabled. Does nothing if the queue is disabled.
+		void drainQueue();
+
 		void setManualTrackEntryDisposal(bool inValue);
 
         bool getManualTrackEntryDisposal();
@@ -470,7 +491,10 @@ namespace spine {
 		Vector<Event *> _events;
 		EventQueue *_queue;
 
-		HashMap<PropertyId, bool> _propertyIDs;
+		Vector<unsigned int> _propertyBits;
+		/// The keyed property IDs, used instead of _propertyBits when an animation on the tracks has no property slots.
+		HashMap<PropertyId, bool> _propertyIds;
+		bool _usePropertyIds;
 		bool _animationsChanged;
 
 		AnimationStateListener _listener;
@@ -482,6 +506,8 @@ namespace spine {
 
 		bool _manualTrackEntryDisposal;
 
+		EventBuffer *_eventBuffer;
+
 		static Animation *getEmptyAnimation();
 
 		static void
@@ -496,8 +522,25 @@ namespace spine {
 
 		float applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBlend currentPose);
 
+		/// Applies only the event timelines, for a dormant skeleton.
+		bool applyDormant(Skeleton &skeleton);
+
+		float applyMixingFromDormant(TrackEntry *to, Skeleton &skeleton, MixBlend blend);
+
 		void queueEvents(TrackEntry *entry, float animationTime);
 
+		/// Marks the property slots as keyed, returning true if any wasn't keyed yet.
+		bool addPropertySlots(Vector<int> &slots);
+
+		/// Marks the properties of the timeline as keyed, returning true if any wasn't keyed yet.
+		bool addProperties(Timeline *timeline);
+
+		/// Returns true if the animation keys any property of the timeline.
+		bool hasProperties(Animation *animation, Timeline *timeline);
+
+		/// Binds the property slots of an animation when it is set or queued, so apply() never modifies the skeleton data.
+		void bindPropertySlots(Animation *animation);
+
 		/// Sets the active TrackEntry for a given track number.
 		void setCurrent(size_t index, TrackEntry *current, bool interrupt);
 
@@ -514,7 +557,8 @@ namespace spine {
 
 		void computeHold(TrackEntry *entry);
 
-		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, bool attachments);
+		void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, int attachmentHandle,
+						   bool attachments);
 	};
 }
 
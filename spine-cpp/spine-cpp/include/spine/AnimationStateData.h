@@ -79,6 +79,13 @@ namespace spine {
 			explicit AnimationPair(Animation *a1 = NULL, Animation *a2 = NULL);
 
 			bool operator==(const AnimationPair &other) const;
+
+			/// Consistent with operator==, which compares animation names.
+			size_t hash() const;
+
+			friend size_t hashMapKey(const AnimationPair &pair) {
+				return pair.hash();
+			}
 		};
 
 		SkeletonData *_skeletonData;
@@ -45,6 +45,8 @@ namespace spine {
 
 	class Event;
 
+	class SkeletonData;
+
 	class SP_API AttachmentTimeline : public Timeline {
 		friend class SkeletonBinary;
 
@@ -66,6 +68,13 @@ namespace spine {
 
 		Vector<String> &getAttachmentNames();
 
+		/// Assigns handles from the skeleton data to the attachment names of all frames, so skeletons using that data find
+		/// the attachments by handle when the timeline is applied. See SkeletonData::findAttachmentHandle().
+		void bindAttachmentHandles(SkeletonData &skeletonData);
+
+		/// Returns the handle of a frame's attachment name, or -1 if the timeline is not bound to the skeleton's data.
+		int getAttachmentHandle(Skeleton &skeleton, size_t frame);
+
 		int getSlotIndex() { return _slotIndex; }
 
 		void setSlotIndex(int inValue) { _slotIndex = inValue; }
@@ -75,7 +84,11 @@ namespace spine {
 
 		Vector<String> _attachmentNames;
 
-		void setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName);
+		Vector<int> _attachmentHandles;
+
+		SkeletonData *_handleData;
+
+		void setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName, int attachmentHandle);
 	};
 }
 
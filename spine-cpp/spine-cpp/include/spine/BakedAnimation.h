@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_BakedAnimation_h
+#define Spine_BakedAnimation_h
+
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	class Animation;
+
+	class Skeleton;
+
+	class Timeline;
+
+	/// An animation sampled at a fixed rate into the world transforms of every bone, for playback without evaluating
+	/// curves, constraints, mixing or Skeleton::updateWorldTransform(). Meant for background skeletons which only ever
+	/// play a single animation.
+	///
+	/// Slot timelines (color, attachment, deform, sequence and draw order) are not baked: apply() applies them from the
+	/// animation, which must outlive the baked animation. Event timelines are not applied.
+	class SP_API BakedAnimation : public SpineObject {
+	public:
+		/// Samples the animation applied to the skeleton at the frame rate, which is rounded up so the last frame is at the
+		/// animation's duration. The skeleton's scale and skin are baked, its position is not and is applied by apply(),
+		/// and physics is simulated from the first frame. The skeleton is left in the setup pose. When quantize is true,
+		/// each transform value is stored in 16 bits relative to the range of that value over the animation, which halves
+		/// the memory but reduces precision.
+		BakedAnimation(Skeleton &skeleton, Animation &animation, float frameRate = 30, bool quantize = false);
+
+		/// Sets the world transforms of the skeleton's bones by interpolating the baked frames at the time, then applies
+		/// the animation's slot timelines. The transforms are interpolated linearly, so stepped keys and fast rotations are
+		/// only exact at the baked frames. Inactive bones and the bones' local and applied transforms are not changed, so
+		/// Skeleton::updateWorldTransform() must not be called afterward. The skeleton must be an instance of the same
+		/// skeleton data used for baking.
+		void apply(Skeleton &skeleton, float time, bool loop);
+
+		Animation &getAnimation();
+
+		float getDuration();
+
+		/// The number of frames, including the frames at time 0 and at the duration.
+		size_t getFrameCount();
+
+		bool isQuantized();
+
+	private:
+		Animation &_animation;
+		Vector<Timeline *> _slotTimelines;
+		size_t _boneCount;
+		size_t _frameCount;
+		float _frameDuration;
+		Vector<float> _frames;
+		Vector<unsigned short> _quantizedFrames;
+		Vector<float> _ranges;
+	};
+}
+
+#endif
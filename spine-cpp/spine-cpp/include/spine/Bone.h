@@ -56,6 +56,8 @@ namespace spine {
 
 		friend class VertexAttachment;
 
+		friend class MeshAttachment;
+
 		friend class PathConstraint;
 
         friend class PhysicsConstraint;
@@ -34,9 +34,11 @@
 #include <spine/Vector.h>
 
 #include <map>
+#include <mutex>
 
 namespace spine {
 
+	/// Tracks allocations of another extension to report leaks. Thread safe if the wrapped extension is.
 	class SP_API DebugExtension : public SpineExtension {
 		struct Allocation {
 			void *address;
@@ -57,6 +59,7 @@ namespace spine {
 		}
 
 		void reportLeaks() {
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
 			for (std::map<void *, Allocation>::iterator it = _allocated.begin(); it != _allocated.end(); it++) {
 				printf("\"%s:%i (%zu bytes at %p)\n", it->second.fileName, it->second.line, it->second.size,
 					   it->second.address);
@@ -66,11 +69,13 @@ namespace spine {
 		}
 
 		void clearAllocations() {
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
 			_allocated.clear();
 			_usedMemory = 0;
 		}
 
 		virtual void *_alloc(size_t size, const char *file, int line) {
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
 			void *result = _extension->_alloc(size, file, line);
 			_allocated[result] = Allocation(result, size, file, line);
 			_allocations++;
@@ -79,6 +84,7 @@ namespace spine {
 		}
 
 		virtual void *_calloc(size_t size, const char *file, int line) {
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
 			void *result = _extension->_calloc(size, file, line);
 			_allocated[result] = Allocation(result, size, file, line);
 			_allocations++;
@@ -87,6 +93,7 @@ namespace spine {
 		}
 
 		virtual void *_realloc(void *ptr, size_t size, const char *file, int line) {
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
 			if (_allocated.count(ptr)) _usedMemory -= _allocated[ptr].size;
 			_allocated.erase(ptr);
 			void *result = _extension->_realloc(ptr, size, file, line);
@@ -97,6 +104,7 @@ namespace spine {
 		}
 
 		virtual void _free(void *mem, const char *file, int line) {
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
 			if (_allocated.count(mem)) {
 				_extension->_free(mem, file, line);
 				_frees++;
@@ -110,6 +118,7 @@ namespace spine {
 		}
 
 		virtual char *_readFile(const String &path, int *length) {
+            std::lock_guard<std::recursive_mutex> lock(_mutex);
             auto data = _extension->_readFile(path, length);
 
             if (_allocated.count(data) == 0) {
@@ -122,6 +131,7 @@ namespace spine {
 		}
 
 		size_t getUsedMemory() {
+			std::lock_guard<std::recursive_mutex> lock(_mutex);
 			return _usedMemory;
 		}
 
@@ -132,6 +142,8 @@ namespace spine {
 		size_t _reallocations;
 		size_t _frees;
 		size_t _usedMemory;
+		// Recursive, as the wrapped extension's _readFile() allocates through this extension.
+		std::recursive_mutex _mutex;
 	};
 }
 
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_EventBuffer_h
+#define Spine_EventBuffer_h
+
+#include <spine/AnimationState.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+#include <atomic>
+
+namespace spine {
+	/// An event raised by an animation state, as stored by EventBuffer.
+	struct SP_API EventRecord {
+		EventType type;
+		int trackIndex;
+		Animation *animation;
+		/// The track entry. Unless AnimationState::setManualTrackEntryDisposal() is enabled, the entry is disposed right
+		/// after its Dispose record is added and may have been reused for another animation by the time the record is
+		/// drained, so only trackIndex and animation should be used then. With manual disposal, the entry stays valid until
+		/// the application disposes it, which it must do for each drained Dispose record.
+		TrackEntry *entry;
+		/// The event for EventType_Event, else NULL. Events are owned by the EventTimeline of the animation, so they are
+		/// deleted with it or when the animation is evicted, see SkeletonData::evictAnimation().
+		Event *event;
+	};
+
+	/// A fixed size ring buffer of events, see AnimationState::setEventBuffer(). Nothing is allocated after construction
+	/// unless Dispose records overflow.
+	///
+	/// One thread may add events, by updating and applying the animation state, while another thread drains them, without
+	/// locking. If the buffer is full, new events are dropped and counted by getDroppedCount(), except Dispose records,
+	/// which are never dropped so manually disposed track entries don't leak. They are kept by the adding thread and
+	/// added the next time the animation state drains its queue with space in the buffer, see getPendingCount().
+	class SP_API EventBuffer : public SpineObject {
+		friend class EventQueue;
+
+	public:
+		/// @param capacity The maximum number of events which can be buffered, rounded up to a power of two.
+		explicit EventBuffer(size_t capacity = 64);
+
+		~EventBuffer();
+
+		/// Removes up to maxCount of the oldest events and copies them to records.
+		/// @return The number of events copied.
+		size_t drain(EventRecord *records, size_t maxCount);
+
+		/// The number of events which can be drained.
+		size_t size();
+
+		size_t getCapacity();
+
+		/// The number of events dropped because the buffer was full.
+		size_t getDroppedCount();
+
+		void resetDroppedCount();
+
+		/// The number of Dispose records which did not fit and wait to be added. Must only be called by the adding thread.
+		size_t getPendingCount();
+
+	private:
+		Vector<EventRecord> _records;
+		size_t _mask;
+		std::atomic<size_t> _head;
+		std::atomic<size_t> _tail;
+		std::atomic<size_t> _dropped;
+		/// Dispose records which did not fit, only used by the adding thread.
+		Vector<EventRecord> _pending;
+
+		void add(EventType type, TrackEntry *entry, Event *event);
+
+		bool add(const EventRecord &record);
+
+		/// Adds as many pending Dispose records as fit.
+		void flush();
+	};
+}
+
+#endif /* Spine_EventBuffer_h */
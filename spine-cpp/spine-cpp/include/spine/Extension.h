@@ -70,6 +70,17 @@ namespace spine {
 			return getInstance()->_readFile(path, length);
 		}
 
+		static const char *mapFile(const String &path, int *length) {
+			return getInstance()->_mapFile(path, length);
+		}
+
+		static void unmapFile(const char *data, int length) {
+			getInstance()->_unmapFile(data, length);
+		}
+
+		/// Sets the extension used by all threads. Must be called before the runtime is used by more than one thread. If
+		/// skeletons are loaded or updated on multiple threads, the extension's functions must be thread safe, as those of
+		/// DefaultSpineExtension are.
 		static void setInstance(SpineExtension *inSpineExtension);
 
 		static SpineExtension *getInstance();
@@ -90,6 +101,15 @@ namespace spine {
 
 		virtual void _beforeFree(void *ptr) { SP_UNUSED(ptr); }
 
+		/// Implement this function to map files into memory for read only access. The default implementation reads the
+		/// whole file with _readFile().
+		virtual const char *_mapFile(const String &path, int *length) { return _readFile(path, length); }
+
+		virtual void _unmapFile(const char *data, int length) {
+			SP_UNUSED(length);
+			_free((void *) data, __FILE__, __LINE__);
+		}
+
 	protected:
 		SpineExtension();
 
@@ -97,6 +117,7 @@ namespace spine {
 		static SpineExtension *_instance;
 	};
 
+	/// Allocates with malloc() and reads files with the C standard library, so it is thread safe.
 	class SP_API DefaultSpineExtension : public SpineExtension {
 	public:
 		DefaultSpineExtension();
@@ -113,6 +134,10 @@ namespace spine {
 		virtual void _free(void *mem, const char *file, int line) override;
 
 		virtual char *_readFile(const String &path, int *length) override;
+
+		virtual const char *_mapFile(const String &path, int *length) override;
+
+		virtual void _unmapFile(const char *data, int length) override;
 	};
 
 // This function is to be implemented by engine specific runtimes to provide
@@ -32,6 +32,9 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+#include <stdint.h>
 
 // Required for new with line number and file name in MSVC
 #ifdef _MSC_VER
@@ -42,11 +45,36 @@
 #endif
 
 namespace spine {
+	/// Returns the hash of a HashMap key. Overloads for other key types are found by argument dependent lookup, so they
+	/// can be declared next to the key type, eg as a friend function.
+	inline size_t hashMapKey(long long key) {
+		uint64_t hash = (uint64_t) key * 0x9E3779B97F4A7C15ULL;
+		return (size_t) (hash >> 32);
+	}
+
+	template<typename T>
+	inline size_t hashMapKey(T *key) {
+		return hashMapKey((long long) (uintptr_t) key);
+	}
+
+	/// The FNV-1a hash of a null terminated string, used for String keys and the names of indexed Json documents. NULL
+	/// hashes like an empty string.
+	inline size_t hashString(const char *chars) {
+		uint32_t hash = 2166136261u;
+		if (chars) {
+			while (*chars) hash = (hash ^ (unsigned char) *chars++) * 16777619u;
+		}
+		return hash;
+	}
+
+	inline size_t hashMapKey(const String &key) {
+		return hashString(key.buffer());
+	}
+
+	/// A hash map using open addressing with linear probing. Keys and values are stored in contiguous arrays, so lookups
+	/// are O(1) and put() only allocates when the table grows. Keys need operator== and a hashMapKey() overload.
 	template<typename K, typename V>
 	class SP_API HashMap : public SpineObject {
-	private:
-		class Entry;
-
 	public:
 		class SP_API Pair {
 		public:
@@ -60,47 +88,44 @@ namespace spine {
 		public:
 			friend class HashMap;
 
-			explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-				_start.next = entry;
-				_entry = &_start;
+			explicit Entries(HashMap *map) : _map(map), _index(0), _hasChecked(false) {
 			}
 
 			Pair next() {
-				assert(_entry);
 				assert(_hasChecked);
-				_entry = _entry->next;
-				Pair pair(_entry->_key, _entry->_value);
+				assert(_index < _map->_used.size() && _map->_used[_index]);
+				Pair pair(_map->_keys[_index], _map->_values[_index]);
+				_index++;
 				_hasChecked = false;
 				return pair;
 			}
 
 			bool hasNext() {
 				_hasChecked = true;
-				return _entry->next;
+				while (_index < _map->_used.size() && !_map->_used[_index]) _index++;
+				return _index < _map->_used.size();
 			}
 
 		private:
+			HashMap *_map;
+			size_t _index;
 			bool _hasChecked;
-			Entry _start;
-			Entry *_entry;
 		};
 
-		HashMap() :
-				_head(NULL),
-				_size(0) {
+		HashMap() : _size(0) {
 		}
 
 		~HashMap() {
-			clear();
 		}
 
+		/// Removes all entries, keeping the capacity.
 		void clear() {
-			for (Entry *entry = _head; entry != NULL;) {
-				Entry *next = entry->next;
-				delete entry;
-				entry = next;
+			for (size_t i = 0, n = _used.size(); i < n; i++) {
+				if (!_used[i]) continue;
+				_used[i] = false;
+				_keys[i] = K();
+				_values[i] = V();
 			}
-			_head = NULL;
 			_size = 0;
 		}
 
@@ -109,26 +134,14 @@ namespace spine {
 		}
 
 		void put(const K &key, const V &value) {
-			Entry *entry = find(key);
-			if (entry) {
-				entry->_key = key;
-				entry->_value = value;
-			} else {
-				entry = new(__FILE__, __LINE__) Entry();
-				entry->_key = key;
-				entry->_value = value;
-
-				Entry *oldHead = _head;
-
-				if (oldHead) {
-					_head = entry;
-					oldHead->prev = entry;
-					entry->next = oldHead;
-				} else {
-					_head = entry;
-				}
+			if ((_size + 1) << 1 > _used.size()) grow();
+			size_t index = find(key);
+			if (!_used[index]) {
+				_used[index] = true;
 				_size++;
 			}
+			_keys[index] = key;
+			_values[index] = value;
 		}
 
 		bool addAll(Vector <K> &keys, const V &value) {
@@ -140,60 +153,77 @@ namespace spine {
 		}
 
 		bool containsKey(const K &key) {
-			return find(key) != NULL;
+			return _size > 0 && _used[find(key)];
 		}
 
 		bool remove(const K &key) {
-			Entry *entry = find(key);
-			if (!entry) return false;
-
-			Entry *prev = entry->prev;
-			Entry *next = entry->next;
-
-			if (prev) prev->next = next;
-			else _head = next;
-			if (next) next->prev = entry->prev;
-
-			delete entry;
+			if (_size == 0) return false;
+			size_t index = find(key);
+			if (!_used[index]) return false;
+
+			// Shift back the entries after the removed one which would no longer be found, so no tombstones are needed.
+			size_t mask = _used.size() - 1;
+			for (size_t next = (index + 1) & mask; _used[next]; next = (next + 1) & mask) {
+				size_t home = hashMapKey(_keys[next]) & mask;
+				if (((next - home) & mask) < ((next - index) & mask)) continue;
+				_keys[index] = _keys[next];
+				_values[index] = _values[next];
+				index = next;
+			}
+			_used[index] = false;
+			_keys[index] = K();
+			_values[index] = V();
 			_size--;
-
 			return true;
 		}
 
 		V operator[](const K &key) {
-			Entry *entry = find(key);
-			if (entry) return entry->_value;
-			else {
-				assert(false);
-				return 0;
+			if (_size > 0) {
+				size_t index = find(key);
+				if (_used[index]) return _values[index];
 			}
+			assert(false);
+			return 0;
 		}
 
 		Entries getEntries() const {
-			return Entries(_head);
+			return Entries(const_cast<HashMap *>(this));
 		}
 
 	private:
-		Entry *find(const K &key) {
-			for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-				if (entry->_key == key)
-					return entry;
-			}
-			return NULL;
-		}
-
-		class SP_API Entry : public SpineObject {
-		public:
-			K _key;
-			V _value;
-			Entry *next;
-			Entry *prev;
+		Vector<K> _keys;
+		Vector<V> _values;
+		Vector<bool> _used;
+		size_t _size;
 
-			Entry() : next(NULL), prev(NULL) {}
-		};
+		/// Returns the index of the key, or of the empty slot where it would be put. The table must not be empty.
+		size_t find(const K &key) {
+			size_t mask = _used.size() - 1;
+			size_t index = hashMapKey(key) & mask;
+			while (_used[index] && !(_keys[index] == key))
+				index = (index + 1) & mask;
+			return index;
+		}
 
-		Entry *_head;
-		size_t _size;
+		void grow() {
+			size_t capacity = _used.size() > 0 ? _used.size() << 1 : 8;
+			Vector<K> keys(_keys);
+			Vector<V> values(_values);
+			Vector<bool> used(_used);
+			_keys.clear();
+			_keys.setSize(capacity, K());
+			_values.clear();
+			_values.setSize(capacity, V());
+			_used.clear();
+			_used.setSize(capacity, false);
+			for (size_t i = 0, n = used.size(); i < n; i++) {
+				if (!used[i]) continue;
+				size_t index = find(keys[i]);
+				_used[index] = true;
+				_keys[index] = keys[i];
+				_values[index] = values[i];
+			}
+		}
 	};
 }
 
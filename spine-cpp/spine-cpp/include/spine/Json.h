@@ -31,6 +31,7 @@
 #define Spine_Json_h
 
 #include <spine/SpineObject.h>
+#include <spine/Vector.h>
 
 #ifndef SPINE_JSON_HAVE_PREV
 /* spine doesn't use the "prev" link in the Json sibling lists. */
@@ -38,9 +39,13 @@
 #endif
 
 namespace spine {
+	class BlockAllocator;
+
 	class SP_API Json : public SpineObject {
 		friend class SkeletonJson;
 
+		friend class JsonReader;
+
 	public:
 		/* Json Types: */
 		static const int JSON_FALSE;
@@ -51,7 +56,7 @@ namespace spine {
 		static const int JSON_ARRAY;
 		static const int JSON_OBJECT;
 
-		/* Get item "string" from object. Case insensitive. */
+		/* Get item "string" from object. Case insensitive, unless the object was parsed with indexing. */
 		static Json *getItem(Json *object, const char *string);
 
 		static Json *getItem(Json *object, int childIndex);
@@ -64,18 +69,22 @@ namespace spine {
 
 		static bool getBoolean(Json *object, const char *name, bool defaultValue);
 
-		/* For analysing failed parses. This returns a pointer to the parse error. You'll probably need to look a few chars back to make sense of it. Defined when Json_create() returns 0. 0 when Json_create() succeeds. */
+		/* For analysing failed parses. This returns a pointer to the parse error. You'll probably need to look a few chars back to make sense of it. Defined when Json_create() returns 0. 0 when Json_create() succeeds. The error is kept per thread. */
 		static const char *getError();
 
 		/* Supply a block of JSON, and this returns a Json object you can interrogate. Call Json_dispose when finished. */
 		explicit Json(const char *value);
 
+		/* If indexed is true, the document is parsed for being queried many times: all of its items are allocated from a
+		 * block allocator owned by this root, which frees them at once, and objects with more than 8 items get a hash table, so
+		 * getItem() does not compare every name. getItem() is then case sensitive for all objects of the document, whose
+		 * items must not be deleted individually. */
+		Json(const char *value, bool indexed);
+
 		~Json();
 
 
 	private:
-		static const char *_error;
-
 		Json *_next;
 #if SPINE_JSON_HAVE_PREV
 		Json* _prev; /* next/prev allow you to walk array/object chains. Alternatively, use getSize/getItem */
@@ -91,6 +100,10 @@ namespace spine {
 
 		const char *_name; /* The item's name string, if this item is the child of, or is in the list of subitems of an object. */
 
+		Json **_index; /* For objects parsed with indexing, the items in a hash table, or a marker if there are few items. */
+
+		BlockAllocator *_allocator; /* For the root of a document parsed with indexing, the allocator of all its items. */
+
 		/* Utility to jump whitespace and cr/lf */
 		static const char *skip(const char *inValue);
 
@@ -109,8 +122,61 @@ namespace spine {
 		/* Build an object from the text. */
 		static const char *parseObject(Json *item, const char *value);
 
+		/* Build the hash table of an object parsed with indexing. */
+		static void buildIndex(Json *item);
+
+		/* Case sensitive getItem() for an object parsed with indexing. */
+		static Json *getIndexedItem(Json *object, const char *string);
+
 		static int json_strcasecmp(const char *s1, const char *s2);
 	};
+
+	/* Reads a document one value at a time, so the items of large arrays and objects can be parsed into a Json tree and
+	 * freed one by one instead of building the tree of the whole document. The document must stay valid while it is read. */
+	class SP_API JsonReader : public SpineObject {
+	public:
+		explicit JsonReader(const char *json);
+
+		~JsonReader();
+
+		/* Enters the array or object at the current position. Returns false if the value is of another type. */
+		bool beginArray();
+
+		bool beginObject();
+
+		/* Moves to the next item of the array or object entered last. Returns false after the last item, leaving the
+		 * array or object, or if the document is malformed. The item's value must be read, skipped or entered before
+		 * next() is called again. */
+		bool next();
+
+		/* Parses the value at the current position into a Json tree, named with getName() if it is an object item.
+		 * Returns NULL if the value is malformed, see Json::getError(). */
+		Json *readValue();
+
+		/* Moves past the value at the current position without parsing it. */
+		void skipValue();
+
+		/* The name of the current object item. */
+		const char *getName();
+
+		/* The current position, or NULL if the document is malformed. */
+		const char *getPosition();
+
+		/* Moves to a position returned by getPosition(), outside of any array or object entered so far. */
+		void setPosition(const char *position);
+
+	private:
+		const char *_position;
+		char *_name;
+		/* The closing character of each array or object entered. */
+		Vector<char> _stack;
+		/* True until the first item of the array or object entered last is read. */
+		bool _first;
+
+		bool begin(char open, char close);
+
+		void fail(const char *position);
+	};
 }
 
 #endif /* Spine_Json_h */
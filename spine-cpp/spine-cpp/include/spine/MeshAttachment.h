@@ -46,6 +46,8 @@ namespace spine {
 
 		friend class AtlasAttachmentLoader;
 
+		friend class SkeletonRenderer;
+
 	RTTI_DECL
 
 	public:
@@ -60,6 +62,17 @@ namespace spine {
 
 		void updateRegion();
 
+		/// Packs the bone weights of a weighted mesh into groups of 4 vertices, which computeWorldVertices() then transforms
+		/// together using SIMD, and computes the bounds used by computeBounds(). Called by the skeleton loaders. Must be
+		/// called again if the bones or vertices are changed. Meshes which aren't weighted or use too many bones are not
+		/// packed and use the regular path.
+		void packWeights();
+
+		/// Expands the AABB to contain the mesh's world vertices, without computing them. The bounds of the vertices in the
+		/// space of each bone affecting the mesh are transformed by the bone, so the result is conservative: it contains
+		/// the mesh but may be larger.
+		void computeBounds(Slot &slot, float &minX, float &minY, float &maxX, float &maxY);
+
 		int getHullLength();
 
 		void setHullLength(int inValue);
@@ -116,6 +129,16 @@ namespace spine {
 		int _width, _height;
 		TextureRegion *_region;
 		Sequence *_sequence;
+		Vector<int> _weightBones;
+		Vector<int> _weightCounts;
+		Vector<float> _weightValues;
+		Vector<int> _weightIndices;
+		Vector<int> _boundsBones;
+		Vector<float> _bounds;
+
+		void updateBounds();
+
+		void computeWeightedWorldVertices(Slot &slot, float *worldVertices, size_t offset, size_t stride);
 	};
 }
 
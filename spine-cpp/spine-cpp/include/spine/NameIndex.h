@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_NameIndex_h
+#define Spine_NameIndex_h
+
+#include <spine/ContainerUtil.h>
+#include <spine/HashMap.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+#include <spine/Vector.h>
+
+namespace spine {
+	/// Finds named items of a vector by name in constant time using an open addressing hash table of item indices. The
+	/// index should be rebuilt after items are added, removed or reordered. Until then, find() still returns the right item,
+	/// but falls back to comparing each item's name when the hash table doesn't find the name.
+	class SP_API NameIndex : public SpineObject {
+	public:
+		NameIndex() {
+		}
+
+		template<typename T>
+		void build(Vector<T *> &items) {
+			size_t size = items.size();
+			_items.clear();
+			for (size_t i = 0; i < size; i++)
+				_items.add(items[i]);
+			size_t capacity = 8;
+			while (capacity < size * 2) capacity <<= 1;
+			_indices.clear();
+			_indices.setSize(capacity, -1);
+			size_t mask = capacity - 1;
+			for (size_t i = 0; i < size; i++) {
+				const String &name = items[i]->getName();
+				size_t slot = hash(name) & mask;
+				// Keep the first item with a name, like ContainerUtil::findWithName().
+				while (_indices[slot] >= 0 && !(items[_indices[slot]]->getName() == name))
+					slot = (slot + 1) & mask;
+				if (_indices[slot] < 0) _indices[slot] = (int) i;
+			}
+		}
+
+		/// @return May be NULL.
+		template<typename T>
+		T *find(Vector<T *> &items, const String &name) {
+			if (_indices.size() == 0) return ContainerUtil::findWithName(items, name);
+			assert(name.length() > 0);
+
+			size_t mask = _indices.size() - 1;
+			for (size_t slot = hash(name) & mask;; slot = (slot + 1) & mask) {
+				int index = _indices[slot];
+				if (index < 0) break;
+				if ((size_t) index < items.size() && items[index]->getName() == name) return items[index];
+			}
+			// The name is only missing if the items are still the ones the index was built for.
+			if (isCurrent(items)) return NULL;
+			return ContainerUtil::findWithName(items, name);
+		}
+
+	private:
+		/// The items when the index was built.
+		Vector<void *> _items;
+		Vector<int> _indices;
+
+		template<typename T>
+		bool isCurrent(Vector<T *> &items) {
+			if (items.size() != _items.size()) return false;
+			for (size_t i = 0, n = items.size(); i < n; i++)
+				if (items[i] != _items[i]) return false;
+			return true;
+		}
+
+		static size_t hash(const String &name) {
+			return hashMapKey(name);
+		}
+	};
+}
+
+#endif /* Spine_NameIndex_h */
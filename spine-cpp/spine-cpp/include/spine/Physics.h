@@ -44,6 +44,15 @@ namespace spine {
         /** Physics are not updated but the pose from physics is applied. */
         Physics_Pose
     };
+
+    /** Determines what a physics constraint does when it needs more steps than Skeleton::getMaxPhysicsSteps() allows. */
+    enum PhysicsStepOverflow {
+        /** The allowed steps are simulated and the rest of the elapsed time is discarded, slowing down physics. */
+        PhysicsStepOverflow_Discard,
+
+        /** Physics are reset to the current pose. */
+        PhysicsStepOverflow_Reset
+    };
 }
 
 #endif
\ No newline at end of file
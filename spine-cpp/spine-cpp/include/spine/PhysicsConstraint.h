@@ -191,6 +191,30 @@ namespace spine {
         Skeleton& _skeleton;
         float _remaining;
         float _lastTime;
+        float _dampingFactor;
+        float _factorDamping;
+        float _factorStep;
+
+        /// Returns pow(damping, 60 * step), computed again only when the damping or step changed.
+        float getDampingFactor(float step);
+
+        // The phases of update() for Physics_Update, which Skeleton also runs for several constraints at once.
+
+        /// Accumulates the elapsed time and applies the bone's movement to the translation offsets. Returns the number of
+        /// steps to simulate, or -1 if the constraint was reset and doesn't step this frame. Sets the translation limits.
+        int beginUpdate(float &qx, float &qy);
+
+        void stepTranslation(int steps);
+
+        /// Applies the bone's movement to the rotation and scale offsets. Sets the bone's world rotation, the cosine and
+        /// sine of the rotation used by the first step, and the rotate mix.
+        void beginRotation(float qx, float qy, float &ca, float &c, float &s, float &mr);
+
+        /// Simulates steps from through to - 1 of steps, where c and s are the cosine and sine for step from.
+        void stepRotation(int from, int to, int steps, float ca, float c, float s, float mr);
+
+        /// Applies the rotation and scale offsets to the bone.
+        void endUpdate(Physics physics);
     };
 }
 
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#ifndef Spine_Simd_h
+#define Spine_Simd_h
+
+// SSE2 or NEON are used when the compiler targets them, unless SPINE_NO_SIMD is defined. Otherwise a scalar fallback
+// with the same results is used.
+#if !defined(SPINE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SPINE_SIMD_SSE
+#include <emmintrin.h>
+#elif !defined(SPINE_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define SPINE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace spine {
+#if defined(SPINE_SIMD_SSE)
+	typedef __m128 Float4;
+#elif defined(SPINE_SIMD_NEON)
+	typedef float32x4_t Float4;
+#else
+	struct Float4 {
+		float v[4];
+	};
+#endif
+
+	/// Four float lanes operated on together. Loads and stores don't require alignment.
+	class Simd {
+	public:
+		static inline Float4 zero() {
+#if defined(SPINE_SIMD_SSE)
+			return _mm_setzero_ps();
+#elif defined(SPINE_SIMD_NEON)
+			return vdupq_n_f32(0);
+#else
+			Float4 r = {{0, 0, 0, 0}};
+			return r;
+#endif
+		}
+
+		static inline Float4 splat(float value) {
+#if defined(SPINE_SIMD_SSE)
+			return _mm_set1_ps(value);
+#elif defined(SPINE_SIMD_NEON)
+			return vdupq_n_f32(value);
+#else
+			Float4 r = {{value, value, value, value}};
+			return r;
+#endif
+		}
+
+		static inline Float4 load(const float *values) {
+#if defined(SPINE_SIMD_SSE)
+			return _mm_loadu_ps(values);
+#elif defined(SPINE_SIMD_NEON)
+			return vld1q_f32(values);
+#else
+			Float4 r = {{values[0], values[1], values[2], values[3]}};
+			return r;
+#endif
+		}
+
+		/// Loads values[indices[0]], ..., values[indices[3]].
+		static inline Float4 gather(const float *values, const int *indices) {
+#if defined(SPINE_SIMD_SSE)
+			return _mm_set_ps(values[indices[3]], values[indices[2]], values[indices[1]], values[indices[0]]);
+#else
+			float lanes[4] = {values[indices[0]], values[indices[1]], values[indices[2]], values[indices[3]]};
+			return load(lanes);
+#endif
+		}
+
+		/// Loads 4 consecutive values from rows + indices[lane] * 4 for each lane, transposed so x has the first value of
+		/// each row, y the second, and z the third. The fourth value of each row is ignored.
+		static inline void gatherRows(const float *rows, const int *indices, Float4 &x, Float4 &y, Float4 &z) {
+#if defined(SPINE_SIMD_SSE)
+			__m128 r0 = _mm_loadu_ps(rows + (indices[0] << 2)), r1 = _mm_loadu_ps(rows + (indices[1] << 2));
+			__m128 r2 = _mm_loadu_ps(rows + (indices[2] << 2)), r3 = _mm_loadu_ps(rows + (indices[3] << 2));
+			__m128 t0 = _mm_unpacklo_ps(r0, r1), t1 = _mm_unpacklo_ps(r2, r3);
+			__m128 t2 = _mm_unpackhi_ps(r0, r1), t3 = _mm_unpackhi_ps(r2, r3);
+			x = _mm_movelh_ps(t0, t1);
+			y = _mm_movehl_ps(t1, t0);
+			z = _mm_movelh_ps(t2, t3);
+#else
+			const float *r0 = rows + (indices[0] << 2), *r1 = rows + (indices[1] << 2);
+			const float *r2 = rows + (indices[2] << 2), *r3 = rows + (indices[3] << 2);
+			float lanes[4] = {r0[0], r1[0], r2[0], r3[0]};
+			x = load(lanes);
+			lanes[0] = r0[1], lanes[1] = r1[1], lanes[2] = r2[1], lanes[3] = r3[1];
+			y = load(lanes);
+			lanes[0] = r0[2], lanes[1] = r1[2], lanes[2] = r2[2], lanes[3] = r3[2];
+			z = load(lanes);
+#endif
+		}
+
+		static inline void store(float *out, Float4 value) {
+#if defined(SPINE_SIMD_SSE)
+			_mm_storeu_ps(out, value);
+#elif defined(SPINE_SIMD_NEON)
+			vst1q_f32(out, value);
+#else
+			out[0] = value.v[0];
+			out[1] = value.v[1];
+			out[2] = value.v[2];
+			out[3] = value.v[3];
+#endif
+		}
+
+		static inline Float4 add(Float4 a, Float4 b) {
+#if defined(SPINE_SIMD_SSE)
+			return _mm_add_ps(a, b);
+#elif defined(SPINE_SIMD_NEON)
+			return vaddq_f32(a, b);
+#else
+			Float4 r = {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+			return r;
+#endif
+		}
+
+		static inline Float4 sub(Float4 a, Float4 b) {
+#if defined(SPINE_SIMD_SSE)
+			return _mm_sub_ps(a, b);
+#elif defined(SPINE_SIMD_NEON)
+			return vsubq_f32(a, b);
+#else
+			Float4 r = {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+			return r;
+#endif
+		}
+
+		static inline Float4 mul(Float4 a, Float4 b) {
+#if defined(SPINE_SIMD_SSE)
+			return _mm_mul_ps(a, b);
+#elif defined(SPINE_SIMD_NEON)
+			return vmulq_f32(a, b);
+#else
+			Float4 r = {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+			return r;
+#endif
+		}
+
+		/// Returns true if every lane of a is greater than the same lane of b.
+		static inline bool allGreater(Float4 a, Float4 b) {
+#if defined(SPINE_SIMD_SSE)
+			return _mm_movemask_ps(_mm_cmpgt_ps(a, b)) == 15;
+#elif defined(SPINE_SIMD_NEON)
+			uint32x4_t mask = vcgtq_f32(a, b);
+			uint32x2_t half = vand_u32(vget_low_u32(mask), vget_high_u32(mask));
+			return (vget_lane_u32(half, 0) & vget_lane_u32(half, 1)) != 0;
+#else
+			return a.v[0] > b.v[0] && a.v[1] > b.v[1] && a.v[2] > b.v[2] && a.v[3] > b.v[3];
+#endif
+		}
+	};
+}
+
+#endif /* Spine_Simd_h */
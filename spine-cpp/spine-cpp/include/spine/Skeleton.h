@@ -63,6 +63,8 @@ namespace spine {
 	class SP_API Skeleton : public SpineObject {
 		friend class AnimationState;
 
+		friend class PhysicsConstraint;
+
 		friend class SkeletonBounds;
 
 		friend class SkeletonClipping;
@@ -136,6 +138,55 @@ namespace spine {
 
 		void updateWorldTransform(Physics physics, Bone *parent);
 
+		/// When true, consecutive bones in the update cache are updated together from a structure of arrays pose buffer owned
+		/// by the skeleton instead of one at a time through Updatable::update(). Constraints and bones which don't use
+		/// Inherit_Normal still use the regular path. This reduces cache misses and virtual calls for skeletons with many
+		/// bones. World transforms are computed the same way as by the regular path. Only used by
+		/// updateWorldTransform(Physics). Default is false.
+		void setUsePoseBuffer(bool usePoseBuffer);
+
+		bool getUsePoseBuffer();
+
+		/// When true, bones and physics constraints between other constraints in the update cache are reordered so physics
+		/// constraints which don't depend on each other, eg at the same depth of different hair strands, are next to each
+		/// other. Their steps are then simulated 4 at a time from a structure of arrays owned by the skeleton. The results are
+		/// the same as updating the constraints one at a time. This reduces the cost of skeletons with many physics
+		/// constraints, especially when each simulates several steps per frame. Only used by
+		/// updateWorldTransform(Physics). Default is false.
+		void setUsePhysicsBatch(bool usePhysicsBatch);
+
+		bool getUsePhysicsBatch();
+
+		/// When true, the skeleton is dormant, eg because it is offscreen: AnimationState::apply() only fires events and
+		/// track entry callbacks without posing the skeleton, and updateWorldTransform() does nothing. update() still
+		/// advances the time. When set back to false, the skeleton is set to the setup pose so the next
+		/// AnimationState::apply() poses it for the current track times, and the next updateWorldTransform() which doesn't
+		/// use Physics_None uses wakePhysics instead, so physics constraints don't simulate the whole time the skeleton
+		/// was dormant. Physics_None for wakePhysics keeps the physics passed to updateWorldTransform(). Default is false.
+		void setDormant(bool dormant, Physics wakePhysics = Physics_Reset);
+
+		bool isDormant();
+
+		/// The maximum number of steps each physics constraint simulates per updateWorldTransform(), or 0 for no limit.
+		/// Without a limit, a long frame or a skeleton which was not updated for a while can simulate hundreds of steps
+		/// per constraint. Default is 0.
+		int getMaxPhysicsSteps();
+
+		void setMaxPhysicsSteps(int maxPhysicsSteps);
+
+		/// What a physics constraint does when it needs more steps than getMaxPhysicsSteps(). Default is
+		/// PhysicsStepOverflow_Discard.
+		PhysicsStepOverflow getPhysicsStepOverflow();
+
+		void setPhysicsStepOverflow(PhysicsStepOverflow physicsStepOverflow);
+
+		/// The number of steps simulated by all physics constraints during the last updateWorldTransform().
+		int getPhysicsSteps();
+
+		/// The number of physics constraints which needed more steps than getMaxPhysicsSteps() during the last
+		/// updateWorldTransform().
+		int getPhysicsStepOverflows();
+
 		/// Sets the bones, constraints, and slots to their setup pose values.
 		void setToSetupPose();
 
@@ -144,9 +195,11 @@ namespace spine {
 
 		void setSlotsToSetupPose();
 
+		/// Finds a bone by name using SkeletonData::findBone().
 		/// @return May be NULL.
 		Bone *findBone(const String &boneName);
 
+		/// Finds a slot by name using SkeletonData::findSlot().
 		/// @return May be NULL.
 		Slot *findSlot(const String &slotName);
 
@@ -165,9 +218,17 @@ namespace spine {
 		/// @return May be NULL.
 		Attachment *getAttachment(const String &slotName, const String &attachmentName);
 
+		/// Uses getAttachmentByHandle() if the name has a handle, see SkeletonData::findAttachmentHandle(), otherwise
+		/// compares the names of the skin's and the default skin's attachments.
 		/// @return May be NULL.
 		Attachment *getAttachment(int slotIndex, const String &attachmentName);
 
+		/// Finds an attachment by a handle from SkeletonData::findAttachmentHandle(), first in the skin, then in the default
+		/// skin.
+		/// @return May be NULL.
+		Attachment *getAttachmentByHandle(int slotIndex, int attachmentHandle);
+
+		/// Finds the slot with SkeletonData::findSlot() and the attachment with getAttachment(int, const String &).
 		/// @param attachmentName May be empty.
 		void setAttachment(const String &slotName, const String &attachmentName);
 
@@ -193,6 +254,13 @@ namespace spine {
         void getBounds(float &outX, float &outY, float &outWidth, float &outHeight, Vector<float> &outVertexBuffer);
 		void getBounds(float &outX, float &outY, float &outWidth, float &outHeight, Vector<float> &outVertexBuffer, SkeletonClipping *clipper);
 
+		/// Returns an AABB containing the region and mesh attachments for the current pose, without computing the mesh
+		/// vertices. Meshes use the bounds of their vertices in the space of each bone, computed when they are loaded, so
+		/// the AABB may be larger than the one returned by getBounds() and clipping attachments are not taken into account.
+		/// Cheap enough to be used for culling every frame. The bones' world transforms are used as is, so calling this
+		/// before updateWorldTransform() returns the bounds of the previous pose.
+		void getConservativeBounds(float &outX, float &outY, float &outWidth, float &outHeight);
+
 		Bone *getRootBone();
 
 		SkeletonData *getData();
@@ -263,6 +331,21 @@ namespace spine {
 		float _scaleX, _scaleY;
 		float _x, _y;
         float _time;
+		bool _usePoseBuffer;
+		bool _usePhysicsBatch;
+		bool _dormant;
+		Physics _wakePhysics;
+		int _maxPhysicsSteps;
+		PhysicsStepOverflow _physicsStepOverflow;
+		int _physicsSteps;
+		int _physicsStepOverflows;
+		Vector<float> _poseBuffer;
+		Vector<int> _poseRuns;
+		Vector<int> _poseRunBones;
+		Vector<int> _poseRunParents;
+		Vector<int> _physicsRuns;
+		Vector<float> _physicsBuffer;
+		Vector<int> _physicsRunLanes;
 
 		void sortIkConstraint(IkConstraint *constraint);
 
@@ -279,6 +362,14 @@ namespace spine {
 		void sortBone(Bone *bone);
 
 		static void sortReset(Vector<Bone *> &bones);
+
+		void updatePoseRuns();
+
+		void updatePoseRun(size_t start, size_t end, Physics physics);
+
+		void updatePhysicsRuns();
+
+		void updatePhysicsRun(size_t start, size_t end, Physics physics);
 	};
 }
 
@@ -64,6 +64,8 @@ namespace spine {
 	class Sequence;
 
 	class SP_API SkeletonBinary : public SpineObject {
+		friend class SkeletonData;
+
 	public:
 		static const int BONE_ROTATE = 0;
 		static const int BONE_TRANSLATE = 1;
@@ -116,6 +118,17 @@ namespace spine {
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// When true, readSkeletonData() reads each animation once to find where it ends, then deletes its timelines and
+		/// keeps only its name, duration and offset in the binary data. The timelines are decoded again the first time the
+		/// animation is found with SkeletonData::findAnimation() or set on an AnimationState, see
+		/// SkeletonData::decodeAnimation(). This reduces the memory used by animations that are not used, not the load
+		/// time. The binary data passed to readSkeletonData() must stay valid until the skeleton data is deleted or frozen,
+		/// readSkeletonDataFile() keeps the file mapped that long. SkeletonData::freeze() decodes all animations. Default is
+		/// false.
+		void setLazyAnimations(bool lazyAnimations) { _lazyAnimations = lazyAnimations; }
+
+		bool getLazyAnimations() { return _lazyAnimations; }
+
 		String &getError() { return _error; }
 
 	private:
@@ -129,6 +142,10 @@ namespace spine {
 		String _error;
 		float _scale;
 		const bool _ownsLoader;
+		bool _lazyAnimations;
+
+		/// Used by SkeletonData to decode lazily loaded animations, which doesn't need an attachment loader.
+		explicit SkeletonBinary(float scale);
 
 		void setError(const char *value1, const char *value2);
 
@@ -38,10 +38,20 @@ namespace spine {
 
 	class ClippingAttachment;
 
+	class ClippingCache;
+
 	class SP_API SkeletonClipping : public SpineObject {
 	public:
 		SkeletonClipping();
 
+		~SkeletonClipping();
+
+		/// Starts clipping with the clipping attachment's polygon. For unweighted clipping attachments, the convex
+		/// decomposition of the polygon is made in bone space, cached per clipping attachment and reused while the
+		/// attachment's vertices and the slot's deform are unchanged, so only the world transform is applied each frame.
+		/// Weighted clipping attachments, and polygons whose bone transform is degenerate, are decomposed in world space
+		/// every time.
+		/// @return The number of convex polygons.
 		size_t clipStart(Slot &slot, ClippingAttachment *clip);
 
 		void clipEnd(Slot &slot);
@@ -75,13 +85,29 @@ namespace spine {
 		Vector<float> _scratch;
 		ClippingAttachment *_clipAttachment;
 		Vector<Vector<float> *> *_clippingPolygons;
+		Vector<ClippingCache *> _caches;
+		Vector<float> _polygonBounds;
+		Vector<float> _polygonEdges;
+		Vector<int> _polygonEdgeOffsets;
+
+		/// Returns the cached decomposition of an unweighted clipping attachment, made if needed, or NULL if the polygon
+		/// must be decomposed in world space.
+		ClippingCache *getCache(Slot &slot, ClippingAttachment *clip);
+
+		/// Stores the bounds of each clipping polygon and its edges in blocks of 4 for classify().
+		void computePolygonEdges();
+
+		/// Returns -1 if the triangle is outside the bounds of the clipping polygon, 1 if it is inside the polygon and
+		/// clip() would leave it unchanged, or 0 if it needs to be clipped.
+		int classify(size_t polygon, float x1, float y1, float x2, float y2, float x3, float y3);
 
 		/** Clips the input triangle against the convex, clockwise clipping area. If the triangle lies entirely within the clipping
 		  * area, false is returned. The clipping area must duplicate the first vertex at the end of the vertices list. */
 		bool clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> *clippingArea,
 				  Vector<float> *output);
 
-		static void makeClockwise(Vector<float> &polygon);
+		/// @return True if the polygon was reversed.
+		static bool makeClockwise(Vector<float> &polygon);
 	};
 }
 
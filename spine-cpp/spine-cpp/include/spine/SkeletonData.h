@@ -32,6 +32,9 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
+#include <spine/HashMap.h>
+#include <spine/NameIndex.h>
+#include <spine/Property.h>
 
 namespace spine {
 	class BoneData;
@@ -52,7 +55,30 @@ namespace spine {
 
     class PhysicsConstraintData;
 
+	class SkeletonData;
+
+	/// Notified by SkeletonData when an animation loaded with SkeletonBinary::setLazyAnimations() was decoded, see
+	/// SkeletonData::setAnimationDecodeListener(). This is the hook to bound the memory used by decoded animations, for
+	/// example by evicting the least recently decoded animations that are no longer used.
+	class SP_API AnimationDecodeListener {
+	public:
+		AnimationDecodeListener() {};
+
+		virtual ~AnimationDecodeListener() {};
+
+		/// Called after the timelines of the animation were decoded. Other animations may be evicted here, but not this one.
+		virtual void decoded(SkeletonData &skeletonData, Animation &animation) = 0;
+	};
+
 /// Stores the setup pose and all of the stateless data for a skeleton.
+	///
+	/// Once freeze() was called, any number of threads may create, pose, update and render skeletons and animation states
+	/// using the same skeleton data, as long as each skeleton and animation state is only used by one thread at a time.
+	/// The methods through which the runtime changes skeleton data and animations then do nothing: decodeAnimation(),
+	/// evictAnimation(), bindPropertySlots(), Timeline::setSearchCache() and addAttachmentHandle() for names without a
+	/// handle. Other changes are not checked, so the application must not modify the skeleton data, its animations or
+	/// its attachments after that, except for attachments with a Sequence, whose region is changed when a slot using it
+	/// is rendered. Such attachments should be copied with Attachment::copy() for each thread rendering them.
 	class SP_API SkeletonData : public SpineObject {
 		friend class SkeletonBinary;
 
@@ -65,8 +91,8 @@ namespace spine {
 
 		~SkeletonData();
 
-		/// Finds a bone by comparing each bone's name.
-		/// It is more efficient to cache the results of this method than to call it multiple times.
+		/// Finds a bone by name. The find methods use a hash index built by buildNameIndex() and compare each item's name
+		/// if the index is out of date.
 		/// @return May be NULL.
 		BoneData *findBone(const String &boneName);
 
@@ -79,9 +105,63 @@ namespace spine {
 		/// @return May be NULL.
 		spine::EventData *findEvent(const String &eventDataName);
 
+		/// Decodes the animation if it was loaded with SkeletonBinary::setLazyAnimations() and not decoded yet.
 		/// @return May be NULL.
 		Animation *findAnimation(const String &animationName);
 
+		/// Decodes the timelines of an animation loaded with SkeletonBinary::setLazyAnimations(). Does nothing if the
+		/// animation was already decoded or the skeleton data is frozen. This changes the skeleton data, so it is not
+		/// thread safe.
+		/// @return False if the animation data is invalid.
+		bool decodeAnimation(Animation *animation);
+
+		/// Deletes the timelines of an animation loaded with SkeletonBinary::setLazyAnimations(), so they are decoded again
+		/// the next time the animation is used. Does nothing if the skeleton data is frozen. The timelines and the events
+		/// of its event timelines are deleted, so the animation must not be evicted while a TrackEntry of any
+		/// AnimationState references it, including entries that are queued or mixing out, nor while an EventBuffer holds
+		/// records of its events that were not drained yet.
+		void evictAnimation(Animation *animation);
+
+		/// Sets the listener notified when an animation is decoded, or NULL. The listener is not owned. Default is NULL.
+		void setAnimationDecodeListener(AnimationDecodeListener *listener);
+
+		AnimationDecodeListener *getAnimationDecodeListener();
+
+		/// Builds the hash index used by the find methods. The loaders call this, it only needs to be called again after
+		/// bones, slots, skins, events, animations or constraints were added or removed.
+		void buildNameIndex();
+
+		/// Prepares the skeleton data to be shared by multiple threads. All animations loaded with
+		/// SkeletonBinary::setLazyAnimations() are decoded without notifying the AnimationDecodeListener and the binary
+		/// data is released, so lazy decoding and eviction end here. Property slots are bound for all animations and the
+		/// search cache of all timelines is disabled, so animations and attachments are no longer changed by the runtime.
+		/// This is not thread safe and should be called right after loading.
+		/// @return False if an animation could not be decoded.
+		bool freeze();
+
+		bool isFrozen();
+
+		/// Returns the handle of an attachment name for a slot, or -1, using a hash table of the slot's names. The loaders
+		/// assign handles to the names used by skins, the slot setup pose and attachment timelines, so
+		/// Skeleton::getAttachmentByHandle() can find attachments without comparing names.
+		int findAttachmentHandle(size_t slotIndex, const String &attachmentName);
+
+		/// Returns the handle of an attachment name for a slot, assigning a new handle if the name has none yet. Returns -1
+		/// for an empty name, or if the name has no handle and the skeleton data is frozen. Attachments without a handle
+		/// are found by name.
+		int addAttachmentHandle(size_t slotIndex, const String &attachmentName);
+
+		const String &getAttachmentHandleName(size_t slotIndex, int attachmentHandle);
+
+		/// The number of distinct properties keyed by the animations bound so far. Each property ID of a timeline is
+		/// assigned a dense slot below this count, so AnimationState can track keyed properties with a bitset.
+		int getPropertySlotCount();
+
+		/// Assigns property slots to the timelines of the animation. The loaders and decodeAnimation() call this for the
+		/// skeleton data's animations, AnimationState::setAnimation() and addAnimation() call it for other animations,
+		/// which is not thread safe. Does nothing once the skeleton data is frozen.
+		void bindPropertySlots(Animation *animation);
+
 		/// @return May be NULL.
 		IkConstraintData *findIkConstraint(const String &constraintName);
 
@@ -184,11 +264,51 @@ namespace spine {
 		String _version;
 		String _hash;
 		Vector<char *> _strings;
+		/// The animations of skeleton data loaded with SkeletonBinary::setLazyAnimations(), in the binary data, else NULL.
+		const unsigned char *_animationData;
+		const unsigned char *_animationDataEnd;
+		/// The file mapped by SkeletonBinary::readSkeletonDataFile() for lazy animations, unmapped by this skeleton data.
+		const char *_mappedFile;
+		int _mappedFileLength;
+		Vector<int> _animationOffsets;
+		Vector<bool> _animationsDecoded;
+		float _animationScale;
+		AnimationDecodeListener *_animationDecodeListener;
+		bool _frozen;
+		Vector<Vector<String>> _attachmentHandleNames;
+		/// For each slot, an open addressing hash table of the handles of its attachment names, -1 for empty entries.
+		Vector<Vector<int>> _attachmentHandleTables;
+		HashMap<PropertyId, int> _propertySlots;
+		NameIndex _boneIndex;
+		NameIndex _slotIndex;
+		NameIndex _skinIndex;
+		NameIndex _eventIndex;
+		NameIndex _animationIndex;
+		NameIndex _ikConstraintIndex;
+		NameIndex _transformConstraintIndex;
+		NameIndex _pathConstraintIndex;
+		NameIndex _physicsConstraintIndex;
 
 		// Nonessential.
 		float _fps;
 		String _imagesPath;
 		String _audioPath;
+
+		/// Assigns handles to the attachment names of all slots, skins and decoded animations.
+		void bindAttachmentHandles();
+
+		void bindAttachmentHandles(Animation *animation);
+
+		int addPropertySlot(PropertyId id);
+
+		/// Records where an animation loaded with SkeletonBinary::setLazyAnimations() is encoded and deletes the timelines
+		/// the loader read to find where the animation ends.
+		void setEncoded(Animation *animation, int index, int offset);
+
+		void deleteTimelines(Animation *animation);
+
+		/// Unmaps the file or forgets the binary data the lazily loaded animations are decoded from.
+		void releaseAnimationData();
 	};
 }
 
@@ -49,6 +49,8 @@ namespace spine {
 
 	class Json;
 
+	class JsonReader;
+
 	class SkeletonData;
 
 	class Atlas;
@@ -84,6 +86,15 @@ namespace spine {
 		const bool _ownsLoader;
 		String _error;
 
+		/// Reads all top level sections of the document into a Json object, except for the skins and animations, whose
+		/// positions are returned.
+		/// @return NULL if the document is malformed.
+		static Json *readSections(JsonReader &reader, const char *&skins, const char *&animations);
+
+		/// Reads a skin and adds it to the skeleton data.
+		/// @return False if the skin is invalid, in which case the error is set.
+		bool readSkin(Json *skinMap, SkeletonData *skeletonData);
+
 		static Sequence *readSequence(Json *sequence);
 
 		static void
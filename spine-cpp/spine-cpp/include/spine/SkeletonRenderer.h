@@ -34,6 +34,8 @@
 #include <spine/SkeletonClipping.h>
 
 namespace spine {
+    class Attachment;
+
     class Skeleton;
 
     struct SP_API RenderCommand {
@@ -43,12 +45,41 @@ namespace spine {
         uint32_t *darkColors;
         int32_t numVertices;
         uint16_t *indices;
+        /// The indices if SkeletonRenderer::setUse32BitIndices() is enabled, in which case indices is NULL.
+        uint32_t *indices32;
         int32_t numIndices;
         BlendMode blendMode;
         void *texture;
+        /// The interleaved vertices written by SkeletonRenderer::render(Skeleton &, const VertexLayout &, void *, int32_t),
+        /// in which case positions, uvs, colors and darkColors are NULL.
+        void *vertices;
         RenderCommand *next;
     };
 
+    /// The byte order of colors written to interleaved vertices, as a packed 32-bit value.
+    enum VertexColorFormat {
+        VertexColorFormat_ARGB = 0,
+        /// The order expected by OpenGL and most other APIs for 4 unsigned normalized bytes on little endian CPUs.
+        VertexColorFormat_ABGR
+    };
+
+    /// Describes the interleaved vertex format of a backend, so the renderer can write vertices directly into its buffers.
+    /// Offsets and the stride are in bytes. An offset of -1 omits the attribute, except for positions.
+    struct SP_API VertexLayout {
+        VertexLayout();
+
+        int32_t stride;
+        int32_t positionOffset;
+        int32_t uvOffset;
+        int32_t colorOffset;
+        int32_t darkColorOffset;
+        VertexColorFormat colorFormat;
+    };
+
+    class RetainedSlot;
+
+    class RetainedBatch;
+
     class SP_API SkeletonRenderer: public SpineObject {
     public:
         explicit SkeletonRenderer();
@@ -56,12 +87,60 @@ namespace spine {
         ~SkeletonRenderer();
 
         RenderCommand *render(Skeleton &skeleton);
+
+        /// Renders the skeleton, writing the vertices of all returned commands consecutively into the given buffer using
+        /// the layout. Returns NULL without writing anything if the skeleton needs more than maxVertices vertices, see
+        /// getNumVertices().
+        RenderCommand *render(Skeleton &skeleton, const VertexLayout &layout, void *vertices, int32_t maxVertices);
+
+        /// The number of vertices needed by the last call to render() with a vertex layout.
+        int32_t getNumVertices();
+
+        /// Writes the commands computed by the last call to render() with a vertex layout into the given buffer, without
+        /// computing them again. Used after render() returned NULL because the buffer was too small, once the buffer has
+        /// grown to getNumVertices(). Returns NULL if maxVertices is still too small.
+        RenderCommand *writeCommands(const VertexLayout &layout, void *vertices, int32_t maxVertices);
+
+        /// When true, returned commands use indices32 instead of indices and a batch is no longer limited to 65535
+        /// indices, so each run of attachments with the same texture and blend mode is a single command. Default is false.
+        void setUse32BitIndices(bool use32BitIndices);
+
+        bool getUse32BitIndices();
+
+        /// When true, the render commands of each slot are kept between calls to render(). A slot's vertices are only
+        /// recomputed if its attachment, sequence index, color, blend mode, deform, or the world transforms of the bones
+        /// affecting it changed, and batches made only of unchanged slots are returned as is. Slots inside a clipping
+        /// attachment are always recomputed. Only one skeleton should be rendered by a retained renderer, and
+        /// invalidate() must be called after attachments are modified. Default is false.
+        void setRetained(bool retained);
+
+        bool getRetained();
+
+        /// Discards all retained render commands, so the next render() recomputes every slot.
+        void invalidate();
     private:
         BlockAllocator _allocator;
         Vector<float> _worldVertices;
         Vector<unsigned short> _quadIndices;
         SkeletonClipping _clipping;
         Vector<RenderCommand *> _renderCommands;
+        int32_t _numVertices;
+        bool _use32BitIndices;
+        bool _retained;
+        Skeleton *_retainedSkeleton;
+        Vector<RetainedSlot *> _retainedSlots;
+        Vector<RetainedBatch *> _retainedBatches;
+        Vector<bool> _dirtyCommands;
+
+        void computeCommands(Skeleton &skeleton);
+
+        void computeRetainedCommands(Skeleton &skeleton);
+
+        RenderCommand *batchRetainedCommands();
+
+        RenderCommand *batchInterleavedCommands(const VertexLayout &layout, uint8_t *vertices);
+
+        static bool updateBones(Vector<float> &bones, Slot &slot, Attachment *attachment);
     };
 }
 
@@ -43,6 +43,8 @@ namespace spine {
 
 	class ConstraintData;
 
+	class SkeletonData;
+
 /// Stores attachments by slot index and attachment name.
 /// See SkeletonData::getDefaultSkin, Skeleton::getSkin, and
 /// http://esotericsoftware.com/spine-runtime-skins in the Spine Runtimes Guide.
@@ -102,6 +104,8 @@ namespace spine {
 
 			Attachment *get(size_t slotIndex, const String &attachmentName);
 
+			Attachment *get(size_t slotIndex, SkeletonData &skeletonData, int attachmentHandle);
+
 			void remove(size_t slotIndex, const String &attachmentName);
 
 			Entries getEntries();
@@ -113,7 +117,13 @@ namespace spine {
 
 			int findInBucket(Vector <Entry> &, const String &attachmentName);
 
+			void bind(SkeletonData &skeletonData);
+
+			void setHandle(size_t slotIndex, const String &attachmentName, Attachment *attachment);
+
 			Vector <Vector<Entry>> _buckets;
+			SkeletonData *_handleData;
+			Vector <Vector<Attachment *>> _handles;
 		};
 
 		explicit Skin(const String &name);
@@ -127,6 +137,15 @@ namespace spine {
 		/// Returns the attachment for the specified slot index and name, or NULL.
 		Attachment *getAttachment(size_t slotIndex, const String &name);
 
+		/// Returns the attachment for the specified slot index and a handle from SkeletonData::findAttachmentHandle(), or
+		/// NULL. This is an indexed lookup if the skin was bound to the skeleton data, see bindAttachmentHandles().
+		Attachment *getAttachment(size_t slotIndex, SkeletonData &skeletonData, int attachmentHandle);
+
+		/// Assigns handles to the names of the skin's attachments and builds a table to find them by handle. The table is
+		/// kept up to date when attachments are set or removed later. The loaders bind all skins they load, skins created
+		/// by the application must not outlive the skeleton data they are bound to.
+		void bindAttachmentHandles(SkeletonData &skeletonData);
+
 		// Removes the attachment from the skin.
 		void removeAttachment(size_t slotIndex, const String &name);
 
@@ -43,6 +43,8 @@ namespace spine {
 
 		friend class SkeletonJson;
 
+		friend class SkeletonData;
+
 		friend class AttachmentTimeline;
 
 		friend class RGBATimeline;
@@ -101,6 +103,10 @@ namespace spine {
 
 		void setAttachmentName(const String &inValue);
 
+		/// The handle of the setup pose attachment name, see SkeletonData::findAttachmentHandle(). -1 if the name is empty
+		/// or was changed after loading.
+		int getAttachmentHandle();
+
 		BlendMode getBlendMode();
 
 		void setBlendMode(BlendMode inValue);
@@ -118,6 +124,7 @@ namespace spine {
 
 		bool _hasDarkColor;
 		String _attachmentName;
+		int _attachmentHandle;
 		BlendMode _blendMode;
         bool _visible;
 	};
@@ -43,6 +43,8 @@ namespace spine {
 	class Event;
 
 	class SP_API Timeline : public SpineObject {
+		friend class SkeletonData;
+
 	RTTI_DECL
 
 	public:
@@ -74,12 +76,33 @@ namespace spine {
 
 		virtual Vector <PropertyId> &getPropertyIds();
 
+		/// Dense indices for the property IDs, unique within the skeleton data, assigned by SkeletonData when the animation
+		/// is loaded or first applied. See SkeletonData::getPropertySlotCount().
+		Vector<int> &getPropertySlots();
+
+		/// When true, the frame found by the last apply is remembered and checked first on the next apply, making frame
+		/// lookup O(1) during normal playback instead of O(log n). The cache is mutable state on the timeline, so it must
+		/// not be enabled when the timeline is applied from multiple threads at once. Does nothing once the skeleton data
+		/// of the timeline's animation was frozen, see SkeletonData::freeze(). Default is false.
+		void setSearchCache(bool searchCache);
+
+		bool getSearchCache();
+
 	protected:
 		void setPropertyIds(PropertyId propertyIds[], size_t propertyIdsCount);
 
+		/// Returns the index of the frame at or before time, using the search cache if enabled. See Animation::search().
+		int search(float time);
+
+		int search(float time, size_t step);
+
         Vector <PropertyId> _propertyIds;
+		Vector<int> _propertySlots;
 		Vector<float> _frames;
 		size_t _frameEntries;
+		bool _searchCache;
+		bool _frozen;
+		int _searchHint;
 	};
 }
 
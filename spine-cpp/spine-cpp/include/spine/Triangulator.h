@@ -35,6 +35,8 @@
 
 namespace spine {
 	class SP_API Triangulator : public SpineObject {
+		friend class SkeletonClipping;
+
 	public:
 		~Triangulator();
 
@@ -38,11 +38,21 @@
 
 using namespace spine;
 
-Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(timelines),
+Animation::Animation(const String &name, Vector<Timeline *> &timelines, float duration) : _timelines(),
 																						  _timelineIds(),
+																						  _propertySlotsBound(false),
+																						  _index(-1),
 																						  _duration(duration),
 																						  _name(name) {
 	assert(_name.length() > 0);
+	setTimelines(timelines);
+}
+
+void Animation::setTimelines(Vector<Timeline *> &timelines) {
+	_timelines.clearAndAddAll(timelines);
+	_timelineIds.clear();
+	_propertySlotBits.clear();
+	_propertySlotsBound = false;
 	for (size_t i = 0; i < timelines.size(); i++) {
 		Vector<PropertyId> propertyIds = timelines[i]->getPropertyIds();
 		for (size_t ii = 0; ii < propertyIds.size(); ii++)
@@ -57,6 +67,14 @@ bool Animation::hasTimeline(Vector<PropertyId> &ids) {
 	return false;
 }
 
+bool Animation::hasPropertySlots(Vector<int> &slots) {
+	for (size_t i = 0; i < slots.size(); i++) {
+		size_t word = (size_t) slots[i] >> 5;
+		if (word < _propertySlotBits.size() && (_propertySlotBits[word] & (1u << (slots[i] & 31)))) return true;
+	}
+	return false;
+}
+
 Animation::~Animation() {
 	ContainerUtil::cleanUpVectorOfPointers(_timelines);
 }
@@ -92,16 +110,39 @@ void Animation::setDuration(float inValue) {
 }
 
 int Animation::search(Vector<float> &frames, float target) {
-	size_t n = (int) frames.size();
-	for (size_t i = 1; i < n; i++) {
-		if (frames[i] > target) return (int) (i - 1);
-	}
-	return (int) (n - 1);
+	return search(frames, target, 1);
 }
 
 int Animation::search(Vector<float> &frames, float target, int step) {
-	size_t n = frames.size();
-	for (size_t i = step; i < n; i += step)
-		if (frames[i] > target) return (int) (i - step);
-	return (int) (n - step);
+	// Binary search for the first frame after the first whose time is > target.
+	int low = 1, high = (int) frames.size() / step;
+	while (low < high) {
+		int mid = (low + high) >> 1;
+		if (frames[mid * step] > target)
+			high = mid;
+		else
+			low = mid + 1;
+	}
+	return (low - 1) * step;
+}
+
+int Animation::search(Vector<float> &frames, float target, int step, int &hint) {
+	int n = (int) frames.size();
+	int i = hint;
+	if (i >= 0 && i < n && (i == 0 || frames[i] <= target)) {
+		// Most often time moves forward by less than a frame, so check the hinted frame and the one after it.
+		if (i + step >= n || frames[i + step] > target) return i;
+		i += step;
+		if (i + step >= n || frames[i + step] > target) {
+			hint = i;
+			return i;
+		}
+	}
+	hint = search(frames, target, step);
+	return hint;
+}
+
+void Animation::setSearchCache(bool searchCache) {
+	for (size_t i = 0, n = _timelines.size(); i < n; ++i)
+		_timelines[i]->setSearchCache(searchCache);
 }
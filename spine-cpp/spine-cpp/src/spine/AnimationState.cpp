@@ -35,6 +35,7 @@
 #include <spine/BoneData.h>
 #include <spine/DrawOrderTimeline.h>
 #include <spine/Event.h>
+#include <spine/EventBuffer.h>
 #include <spine/EventTimeline.h>
 #include <spine/RotateTimeline.h>
 #include <spine/Skeleton.h>
@@ -275,12 +276,23 @@ void EventQueue::drain() {
 	_drainDisabled = true;
 
 	AnimationState &state = _state;
+	EventBuffer *buffer = state._eventBuffer;
+	if (buffer) buffer->flush();
 
 	// Don't cache _eventQueueEntries.size() so callbacks can queue their own events (eg, call setAnimation in AnimationState_Complete).
 	for (size_t i = 0; i < _eventQueueEntries.size(); ++i) {
 		EventQueueEntry queueEntry = _eventQueueEntries[i];
 		TrackEntry *trackEntry = queueEntry._entry;
 
+		if (buffer) {
+			buffer->add(queueEntry._type, trackEntry, queueEntry._event);
+			if (queueEntry._type == EventType_End) buffer->add(EventType_Dispose, trackEntry, NULL);
+			if ((queueEntry._type == EventType_End || queueEntry._type == EventType_Dispose) &&
+				!_state.getManualTrackEntryDisposal())
+				_state.disposeTrackEntry(trackEntry);
+			continue;
+		}
+
 		switch (queueEntry._type) {
 			case EventType_Start:
 			case EventType_Interrupt:
@@ -328,12 +340,14 @@ void EventQueue::drain() {
 
 AnimationState::AnimationState(AnimationStateData *data) : _data(data),
 														   _queue(EventQueue::newEventQueue(*this)),
+														   _usePropertyIds(false),
 														   _animationsChanged(false),
 														   _listener(dummyOnAnimationEventFunc),
 														   _listenerObject(NULL),
 														   _unkeyedState(0),
 														   _timeScale(1),
-														   _manualTrackEntryDisposal(false) {
+														   _manualTrackEntryDisposal(false),
+														   _eventBuffer(NULL) {
 }
 
 AnimationState::~AnimationState() {
@@ -425,6 +439,8 @@ void AnimationState::update(float delta) {
 }
 
 bool AnimationState::apply(Skeleton &skeleton) {
+	if (skeleton.isDormant()) return applyDormant(skeleton);
+
 	if (_animationsChanged) {
 		animationsChanged();
 	}
@@ -508,8 +524,13 @@ bool AnimationState::apply(Skeleton &skeleton) {
 	for (int i = 0, n = (int) slots.size(); i < n; i++) {
 		Slot *slot = slots[i];
 		if (slot->getAttachmentState() == setupState) {
-			const String &attachmentName = slot->getData().getAttachmentName();
-			slot->setAttachment(attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot->getData().getIndex(), attachmentName));
+			SlotData &slotData = slot->getData();
+			if (slotData.getAttachmentHandle() >= 0)
+				slot->setAttachment(skeleton.getAttachmentByHandle(slotData.getIndex(), slotData.getAttachmentHandle()));
+			else {
+				const String &attachmentName = slotData.getAttachmentName();
+				slot->setAttachment(attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slotData.getIndex(), attachmentName));
+			}
 		}
 	}
 	_unkeyedState += 2;
@@ -562,6 +583,8 @@ TrackEntry *AnimationState::setAnimation(size_t trackIndex, const String &animat
 
 TrackEntry *AnimationState::setAnimation(size_t trackIndex, Animation *animation, bool loop) {
 	assert(animation != NULL);
+	_data->_skeletonData->decodeAnimation(animation);
+	bindPropertySlots(animation);
 
 	bool interrupt = true;
 	TrackEntry *current = expandToIndex(trackIndex);
@@ -594,6 +617,8 @@ TrackEntry *AnimationState::addAnimation(size_t trackIndex, const String &animat
 
 TrackEntry *AnimationState::addAnimation(size_t trackIndex, Animation *animation, bool loop, float delay) {
 	assert(animation != NULL);
+	_data->_skeletonData->decodeAnimation(animation);
+	bindPropertySlots(animation);
 
 	TrackEntry *last = expandToIndex(trackIndex);
 	if (last != NULL) {
@@ -674,6 +699,14 @@ void AnimationState::setListener(AnimationStateListenerObject *inValue) {
 	_listenerObject = inValue;
 }
 
+void AnimationState::setEventBuffer(EventBuffer *buffer) {
+	_eventBuffer = buffer;
+}
+
+EventBuffer *AnimationState::getEventBuffer() {
+	return _eventBuffer;
+}
+
 void AnimationState::disableQueue() {
 	_queue->_drainDisabled = true;
 }
@@ -682,6 +715,10 @@ void AnimationState::enableQueue() {
 	_queue->_drainDisabled = false;
 }
 
+void AnimationState::drainQueue() {
+	_queue->drain();
+}
+
 void AnimationState::setManualTrackEntryDisposal(bool inValue) {
 	_manualTrackEntryDisposal = inValue;
 }
@@ -709,10 +746,12 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline *attachmentTimel
 	Vector<float> &frames = attachmentTimeline->getFrames();
 	if (time < frames[0]) {
 		if (blend == MixBlend_Setup || blend == MixBlend_First)
-			setAttachment(skeleton, *slot, slot->getData().getAttachmentName(), attachments);
+			setAttachment(skeleton, *slot, slot->getData().getAttachmentName(), slot->getData().getAttachmentHandle(),
+						  attachments);
 	} else {
-		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[Animation::search(frames, time)],
-					  attachments);
+		int frame = Animation::search(frames, time);
+		setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[frame],
+					  attachmentTimeline->getAttachmentHandle(skeleton, frame), attachments);
 	}
 
 	/* If an attachment wasn't set (ie before the first frame or attachments is false), set the setup attachment later.*/
@@ -912,9 +951,107 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	return mix;
 }
 
-void AnimationState::setAttachment(Skeleton &skeleton, Slot &slot, const String &attachmentName, bool attachments) {
-	slot.setAttachment(
-			attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot.getData().getIndex(), attachmentName));
+static void applyEventTimelines(Animation *animation, Skeleton &skeleton, float lastTime, float time,
+								Vector<Event *> *events) {
+	Vector<Timeline *> &timelines = animation->getTimelines();
+	for (size_t i = 0, n = timelines.size(); i < n; i++) {
+		Timeline *timeline = timelines[i];
+		if (timeline->getRTTI().isExactly(EventTimeline::rtti))
+			timeline->apply(skeleton, lastTime, time, events, 1, MixBlend_Replace, MixDirection_In);
+	}
+}
+
+bool AnimationState::applyDormant(Skeleton &skeleton) {
+	if (_animationsChanged) animationsChanged();
+
+	bool applied = false;
+	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
+		TrackEntry *currentP = _tracks[i];
+		if (currentP == NULL || currentP->_delay > 0) continue;
+
+		TrackEntry &current = *currentP;
+		applied = true;
+		MixBlend blend = i == 0 ? MixBlend_First : current._mixBlend;
+		if (current._mixingFrom != NULL) applyMixingFromDormant(currentP, skeleton, blend);
+
+		float animationLast = current._animationLast, animationTime = current.getAnimationTime();
+		if (!current._reverse) applyEventTimelines(current._animation, skeleton, animationLast, animationTime, &_events);
+
+		// The rotation directions are stale once the skeleton wakes, so they are recomputed as for a new entry.
+		current._timelinesRotation.clear();
+
+		queueEvents(currentP, animationTime);
+		_events.clear();
+		current._nextAnimationLast = animationTime;
+		current._nextTrackLast = current._trackTime;
+	}
+
+	_queue->drain();
+	return applied;
+}
+
+float AnimationState::applyMixingFromDormant(TrackEntry *to, Skeleton &skeleton, MixBlend blend) {
+	TrackEntry *from = to->_mixingFrom;
+	if (from->_mixingFrom != NULL) applyMixingFromDormant(from, skeleton, blend);
+
+	float mix;
+	if (to->_mixDuration == 0) {
+		mix = 1;
+		if (blend == MixBlend_First) blend = MixBlend_Setup;
+	} else {
+		mix = to->_mixTime / to->_mixDuration;
+		if (mix > 1) mix = 1;
+		if (blend != MixBlend_First) blend = from->_mixBlend;
+	}
+
+	// The total alpha is computed as in applyMixingFrom(), since updateMixingFrom() needs it to discard the entry.
+	if (blend != MixBlend_Add) {
+		Vector<Timeline *> &timelines = from->_animation->_timelines;
+		Vector<int> &timelineMode = from->_timelineMode;
+		bool drawOrder = mix < from->_mixDrawOrderThreshold;
+		float alphaHold = from->_alpha * to->_interruptAlpha, alphaMix = alphaHold * (1 - mix);
+		from->_totalAlpha = 0;
+		for (size_t i = 0, n = timelines.size(); i < n; i++) {
+			switch (timelineMode[i]) {
+				case Subsequent:
+					if (!drawOrder && (timelines[i]->getRTTI().isExactly(DrawOrderTimeline::rtti))) continue;
+					from->_totalAlpha += alphaMix;
+					break;
+				case First:
+					from->_totalAlpha += alphaMix;
+					break;
+				case HoldSubsequent:
+				case HoldFirst:
+					from->_totalAlpha += alphaHold;
+					break;
+				default:
+					TrackEntry *holdMix = from->_timelineHoldMix[i];
+					from->_totalAlpha += alphaHold * MathUtil::max(0.0f, 1.0f - holdMix->_mixTime / holdMix->_mixDuration);
+					break;
+			}
+		}
+	}
+
+	float animationLast = from->_animationLast, animationTime = from->getAnimationTime();
+	if (!from->_reverse && mix < from->_eventThreshold)
+		applyEventTimelines(from->_animation, skeleton, animationLast, animationTime, &_events);
+	from->_timelinesRotation.clear();
+
+	if (to->_mixDuration > 0) queueEvents(from, animationTime);
+	_events.clear();
+	from->_nextAnimationLast = animationTime;
+	from->_nextTrackLast = from->_trackTime;
+
+	return mix;
+}
+
+void AnimationState::setAttachment(Skeleton &skeleton, Slot &slot, const String &attachmentName, int attachmentHandle,
+								   bool attachments) {
+	if (attachmentHandle >= 0)
+		slot.setAttachment(skeleton.getAttachmentByHandle(slot.getData().getIndex(), attachmentHandle));
+	else
+		slot.setAttachment(
+				attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot.getData().getIndex(), attachmentName));
 	if (attachments) slot.setAttachmentState(_unkeyedState + Current);
 }
 
@@ -1035,7 +1172,24 @@ void AnimationState::clearNext(TrackEntry *entry) {
 void AnimationState::animationsChanged() {
 	_animationsChanged = false;
 
-	_propertyIDs.clear();
+	// The timelines of an animation were changed after it was set, or the skeleton data was frozen before it was bound.
+	// Keyed properties are then tracked by ID for all tracks.
+	_usePropertyIds = false;
+	for (size_t i = 0, n = _tracks.size(); i < n && !_usePropertyIds; ++i) {
+		for (TrackEntry *entry = _tracks[i]; entry != NULL; entry = entry->_mixingFrom) {
+			Animation *animation = entry->_animation;
+			if (!animation->_propertySlotsBound && animation->_timelines.size() > 0) {
+				_usePropertyIds = true;
+				break;
+			}
+		}
+	}
+	if (_usePropertyIds)
+		_propertyIds.clear();
+	else {
+		for (size_t i = 0, n = _propertyBits.size(); i < n; i++)
+			_propertyBits[i] = 0;
+	}
 
 	for (size_t i = 0, n = _tracks.size(); i < n; ++i) {
 		TrackEntry *entry = _tracks[i];
@@ -1062,7 +1216,7 @@ void AnimationState::computeHold(TrackEntry *entry) {
 
 	if (to != NULL && to->_holdPrevious) {
 		for (size_t i = 0; i < timelinesCount; i++) {
-			timelineMode[i] = _propertyIDs.addAll(timelines[i]->getPropertyIds(), true) ? HoldFirst : HoldSubsequent;
+			timelineMode[i] = addProperties(timelines[i]) ? HoldFirst : HoldSubsequent;
 		}
 		return;
 	}
@@ -1072,17 +1226,17 @@ void AnimationState::computeHold(TrackEntry *entry) {
 continue_outer:
 	for (; i < timelinesCount; ++i) {
 		Timeline *timeline = timelines[i];
-		Vector<PropertyId> &ids = timeline->getPropertyIds();
-		if (!_propertyIDs.addAll(ids, true)) {
+		if (!addProperties(timeline)) {
 			timelineMode[i] = Subsequent;
 		} else {
 			if (to == NULL || timeline->getRTTI().isExactly(AttachmentTimeline::rtti) ||
 				timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) ||
-				timeline->getRTTI().isExactly(EventTimeline::rtti) || !to->_animation->hasTimeline(ids)) {
+				timeline->getRTTI().isExactly(EventTimeline::rtti) ||
+				!hasProperties(to->_animation, timeline)) {
 				timelineMode[i] = First;
 			} else {
 				for (TrackEntry *next = to->_mixingTo; next != NULL; next = next->_mixingTo) {
-					if (next->_animation->hasTimeline(ids)) continue;
+					if (hasProperties(next->_animation, timeline)) continue;
 					if (next->_mixDuration > 0) {
 						timelineMode[i] = HoldMix;
 						timelineHoldMix[i] = next;
@@ -1096,3 +1250,33 @@ continue_outer:
 		}
 	}
 }
+
+bool AnimationState::addPropertySlots(Vector<int> &slots) {
+	bool added = false;
+	for (size_t i = 0, n = slots.size(); i < n; i++) {
+		size_t word = (size_t) slots[i] >> 5;
+		unsigned int bit = 1u << (slots[i] & 31);
+		if (word >= _propertyBits.size()) _propertyBits.setSize(word + 1, 0);
+		if (!(_propertyBits[word] & bit)) {
+			_propertyBits[word] |= bit;
+			added = true;
+		}
+	}
+	return added;
+}
+
+bool AnimationState::addProperties(Timeline *timeline) {
+	if (_usePropertyIds) return _propertyIds.addAll(timeline->getPropertyIds(), true);
+	return addPropertySlots(timeline->getPropertySlots());
+}
+
+bool AnimationState::hasProperties(Animation *animation, Timeline *timeline) {
+	if (_usePropertyIds) return animation->hasTimeline(timeline->getPropertyIds());
+	return animation->hasPropertySlots(timeline->getPropertySlots());
+}
+
+void AnimationState::bindPropertySlots(Animation *animation) {
+	// Animations without timelines, such as the shared empty animation, have nothing to bind.
+	if (!animation->_propertySlotsBound && animation->_timelines.size() > 0)
+		_data->_skeletonData->bindPropertySlots(animation);
+}
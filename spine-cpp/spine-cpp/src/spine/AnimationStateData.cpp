@@ -30,6 +30,7 @@
 #include <spine/AnimationStateData.h>
 #include <spine/Animation.h>
 #include <spine/SkeletonData.h>
+#include <spine/ContainerUtil.h>
 
 using namespace spine;
 
@@ -37,8 +38,9 @@ AnimationStateData::AnimationStateData(SkeletonData *skeletonData) : _skeletonDa
 }
 
 void AnimationStateData::setMix(const String &fromName, const String &toName, float duration) {
-	Animation *from = _skeletonData->findAnimation(fromName);
-	Animation *to = _skeletonData->findAnimation(toName);
+	// Mixes don't need the timelines, so lazily loaded animations are not decoded.
+	Animation *from = ContainerUtil::findWithName(_skeletonData->getAnimations(), fromName);
+	Animation *to = ContainerUtil::findWithName(_skeletonData->getAnimations(), toName);
 
 	setMix(from, to, duration);
 }
@@ -84,3 +86,7 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
 	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
 }
+
+size_t AnimationStateData::AnimationPair::hash() const {
+	return hashMapKey(_a1->_name) * 31 + hashMapKey(_a2->_name);
+}
@@ -31,6 +31,7 @@
 
 #include <spine/Event.h>
 #include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
 
 #include <spine/Animation.h>
 #include <spine/Bone.h>
@@ -43,7 +44,8 @@ using namespace spine;
 RTTI_IMPL(AttachmentTimeline, Timeline)
 
 AttachmentTimeline::AttachmentTimeline(size_t frameCount, int slotIndex) : Timeline(frameCount, 1),
-																		   _slotIndex(slotIndex) {
+																		   _slotIndex(slotIndex),
+																		   _handleData(NULL) {
 	PropertyId ids[] = {((PropertyId) Property_Attachment << 32) | slotIndex};
 	setPropertyIds(ids, 1);
 
@@ -51,12 +53,16 @@ AttachmentTimeline::AttachmentTimeline(size_t frameCount, int slotIndex) : Timel
 	for (size_t i = 0; i < frameCount; ++i) {
 		_attachmentNames.add(String());
 	}
+	_attachmentHandles.setSize(frameCount, -1);
 }
 
 AttachmentTimeline::~AttachmentTimeline() {}
 
-void AttachmentTimeline::setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName) {
-	slot.setAttachment(attachmentName == NULL || attachmentName->isEmpty() ? NULL : skeleton.getAttachment(_slotIndex, *attachmentName));
+void AttachmentTimeline::setAttachment(Skeleton &skeleton, Slot &slot, String *attachmentName, int attachmentHandle) {
+	if (attachmentHandle >= 0)
+		slot.setAttachment(skeleton.getAttachmentByHandle(_slotIndex, attachmentHandle));
+	else
+		slot.setAttachment(attachmentName == NULL || attachmentName->isEmpty() ? NULL : skeleton.getAttachment(_slotIndex, *attachmentName));
 }
 
 void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
@@ -69,32 +75,44 @@ void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 	if (!slot->_bone._active) return;
 
 	if (direction == MixDirection_Out) {
-		if (blend == MixBlend_Setup) setAttachment(skeleton, *slot, &slot->_data._attachmentName);
+		if (blend == MixBlend_Setup) setAttachment(skeleton, *slot, &slot->_data._attachmentName, slot->_data._attachmentHandle);
 		return;
 	}
 
 	if (time < _frames[0]) {
 		// Time is before first frame.
 		if (blend == MixBlend_Setup || blend == MixBlend_First) {
-			setAttachment(skeleton, *slot, &slot->_data._attachmentName);
+			setAttachment(skeleton, *slot, &slot->_data._attachmentName, slot->_data._attachmentHandle);
 		}
 		return;
 	}
 
 	if (time < _frames[0]) {
 		if (blend == MixBlend_Setup || blend == MixBlend_First)
-			setAttachment(skeleton, *slot, &slot->_data._attachmentName);
+			setAttachment(skeleton, *slot, &slot->_data._attachmentName, slot->_data._attachmentHandle);
 		return;
 	}
 
-	setAttachment(skeleton, *slot, &_attachmentNames[Animation::search(_frames, time)]);
+	int frame = search(time);
+	setAttachment(skeleton, *slot, &_attachmentNames[frame], getAttachmentHandle(skeleton, frame));
 }
 
 void AttachmentTimeline::setFrame(int frame, float time, const String &attachmentName) {
 	_frames[frame] = time;
 	_attachmentNames[frame] = attachmentName;
+	_attachmentHandles[frame] = _handleData ? _handleData->addAttachmentHandle(_slotIndex, attachmentName) : -1;
 }
 
 Vector<String> &AttachmentTimeline::getAttachmentNames() {
 	return _attachmentNames;
 }
+
+void AttachmentTimeline::bindAttachmentHandles(SkeletonData &skeletonData) {
+	_handleData = &skeletonData;
+	for (size_t i = 0; i < _attachmentNames.size(); i++)
+		_attachmentHandles[i] = skeletonData.addAttachmentHandle(_slotIndex, _attachmentNames[i]);
+}
+
+int AttachmentTimeline::getAttachmentHandle(Skeleton &skeleton, size_t frame) {
+	return _handleData == skeleton._data ? _attachmentHandles[frame] : -1;
+}
@@ -0,0 +1,179 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/BakedAnimation.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/Property.h>
+#include <spine/Skeleton.h>
+#include <spine/Timeline.h>
+
+using namespace spine;
+
+// Each frame stores a, b, c, d, worldX and worldY for every bone.
+static const int CHANNELS = 6;
+
+static bool isSlotTimeline(Timeline *timeline) {
+	PropertyId property = timeline->getPropertyIds()[0] >> 32;
+	return (property & (Property_Rgb | Property_Alpha | Property_Rgb2 | Property_Attachment | Property_Deform |
+						Property_DrawOrder | Property_Sequence)) != 0;
+}
+
+BakedAnimation::BakedAnimation(Skeleton &skeleton, Animation &animation, float frameRate, bool quantize)
+	: _animation(animation), _boneCount(skeleton.getBones().size()), _frameCount(1), _frameDuration(0) {
+	Vector<Timeline *> &timelines = animation.getTimelines();
+	for (size_t i = 0, n = timelines.size(); i < n; i++)
+		if (isSlotTimeline(timelines[i])) _slotTimelines.add(timelines[i]);
+
+	float duration = animation.getDuration();
+	if (duration > 0) {
+		_frameCount = (size_t) MathUtil::ceil(duration * frameRate) + 1;
+		if (_frameCount < 2) _frameCount = 2;
+		_frameDuration = duration / (_frameCount - 1);
+	}
+
+	float x = skeleton.getX(), y = skeleton.getY();
+	skeleton.setPosition(0, 0);
+	skeleton.setToSetupPose();
+
+	Vector<Bone *> &bones = skeleton.getBones();
+	_frames.setSize(_frameCount * _boneCount * CHANNELS, 0);
+	float *frame = _frames.buffer(), lastTime = 0;
+	for (size_t i = 0; i < _frameCount; i++) {
+		float time = i == _frameCount - 1 ? duration : i * _frameDuration;
+		animation.apply(skeleton, lastTime, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		skeleton.update(time - lastTime);
+		skeleton.updateWorldTransform(i == 0 ? Physics_Reset : Physics_Update);
+		for (size_t ii = 0; ii < _boneCount; ii++, frame += CHANNELS) {
+			Bone *bone = bones[ii];
+			frame[0] = bone->getA();
+			frame[1] = bone->getB();
+			frame[2] = bone->getC();
+			frame[3] = bone->getD();
+			frame[4] = bone->getWorldX();
+			frame[5] = bone->getWorldY();
+		}
+		lastTime = time;
+	}
+
+	skeleton.setPosition(x, y);
+	skeleton.setToSetupPose();
+
+	if (!quantize) return;
+
+	// Each bone channel is stored relative to its range over all frames, as a minimum and a step per quantized unit.
+	size_t valueCount = _boneCount * CHANNELS;
+	_ranges.setSize(valueCount << 1, 0);
+	for (size_t i = 0; i < valueCount; i++) {
+		float min = _frames[i], max = _frames[i];
+		for (size_t f = 1; f < _frameCount; f++) {
+			float value = _frames[f * valueCount + i];
+			min = MathUtil::min(min, value);
+			max = MathUtil::max(max, value);
+		}
+		_ranges[i << 1] = min;
+		_ranges[(i << 1) + 1] = (max - min) / 65535;
+	}
+	_quantizedFrames.setSize(_frames.size(), 0);
+	for (size_t i = 0, n = _frames.size(); i < n; i++) {
+		size_t range = (i % valueCount) << 1;
+		float step = _ranges[range + 1];
+		if (step > 0)
+			_quantizedFrames[i] = (unsigned short) MathUtil::clamp((_frames[i] - _ranges[range]) / step + 0.5f, 0.0f, 65535.0f);
+	}
+	_frames.clear();
+}
+
+void BakedAnimation::apply(Skeleton &skeleton, float time, bool loop) {
+	float duration = _animation.getDuration();
+	if (loop && duration != 0) time = MathUtil::fmod(time, duration);
+
+	size_t frameIndex = 0;
+	float alpha = 0;
+	if (_frameDuration > 0 && time > 0) {
+		float position = time / _frameDuration;
+		frameIndex = (size_t) position;
+		if (frameIndex >= _frameCount - 1)
+			frameIndex = _frameCount - 1;
+		else
+			alpha = position - frameIndex;
+	}
+	size_t nextIndex = alpha > 0 ? frameIndex + 1 : frameIndex;
+
+	size_t valueCount = _boneCount * CHANNELS;
+	float values[CHANNELS];
+	float x = skeleton.getX(), y = skeleton.getY();
+	Vector<Bone *> &bones = skeleton.getBones();
+	for (size_t i = 0; i < _boneCount; i++) {
+		Bone *bone = bones[i];
+		if (!bone->isActive()) continue;
+		size_t offset = i * CHANNELS;
+		if (_quantizedFrames.size() > 0) {
+			const unsigned short *frame = _quantizedFrames.buffer() + frameIndex * valueCount + offset;
+			const unsigned short *next = _quantizedFrames.buffer() + nextIndex * valueCount + offset;
+			const float *ranges = _ranges.buffer() + (offset << 1);
+			for (int ii = 0; ii < CHANNELS; ii++) {
+				float value = frame[ii] + (next[ii] - frame[ii]) * alpha;
+				values[ii] = ranges[ii << 1] + value * ranges[(ii << 1) + 1];
+			}
+		} else {
+			const float *frame = _frames.buffer() + frameIndex * valueCount + offset;
+			const float *next = _frames.buffer() + nextIndex * valueCount + offset;
+			for (int ii = 0; ii < CHANNELS; ii++)
+				values[ii] = frame[ii] + (next[ii] - frame[ii]) * alpha;
+		}
+		bone->setA(values[0]);
+		bone->setB(values[1]);
+		bone->setC(values[2]);
+		bone->setD(values[3]);
+		bone->setWorldX(values[4] + x);
+		bone->setWorldY(values[5] + y);
+	}
+
+	for (size_t i = 0, n = _slotTimelines.size(); i < n; i++)
+		_slotTimelines[i]->apply(skeleton, time, time, NULL, 1, MixBlend_Setup, MixDirection_In);
+}
+
+Animation &BakedAnimation::getAnimation() {
+	return _animation;
+}
+
+float BakedAnimation::getDuration() {
+	return _animation.getDuration();
+}
+
+size_t BakedAnimation::getFrameCount() {
+	return _frameCount;
+}
+
+bool BakedAnimation::isQuantized() {
+	return _quantizedFrames.size() > 0;
+}
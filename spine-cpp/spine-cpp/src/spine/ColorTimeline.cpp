@@ -79,7 +79,7 @@ void RGBATimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	}
 
 	float r = 0, g = 0, b = 0, a = 0;
-	int i = Animation::search(_frames, time, RGBATimeline::ENTRIES);
+	int i = search(time, RGBATimeline::ENTRIES);
 	int curveType = (int) _curves[i / RGBATimeline::ENTRIES];
 	switch (curveType) {
 		case RGBATimeline::LINEAR: {
@@ -168,7 +168,7 @@ void RGBTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<E
 	}
 
 	float r = 0, g = 0, b = 0;
-	int i = Animation::search(_frames, time, RGBTimeline::ENTRIES);
+	int i = search(time, RGBTimeline::ENTRIES);
 	int curveType = (int) _curves[i / RGBTimeline::ENTRIES];
 	switch (curveType) {
 		case RGBTimeline::LINEAR: {
@@ -303,7 +303,7 @@ void RGBA2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float r = 0, g = 0, b = 0, a = 0, r2 = 0, g2 = 0, b2 = 0;
-	int i = Animation::search(_frames, time, RGBA2Timeline::ENTRIES);
+	int i = search(time, RGBA2Timeline::ENTRIES);
 	int curveType = (int) _curves[i / RGBA2Timeline::ENTRIES];
 	switch (curveType) {
 		case RGBA2Timeline::LINEAR: {
@@ -422,7 +422,7 @@ void RGB2Timeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<
 	}
 
 	float r = 0, g = 0, b = 0, r2 = 0, g2 = 0, b2 = 0;
-	int i = Animation::search(_frames, time, RGB2Timeline::ENTRIES);
+	int i = search(time, RGB2Timeline::ENTRIES);
 	int curveType = (int) _curves[i / RGB2Timeline::ENTRIES];
 	switch (curveType) {
 		case RGB2Timeline::LINEAR: {
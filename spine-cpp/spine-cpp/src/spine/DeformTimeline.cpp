@@ -180,7 +180,7 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 	}
 
 	// Interpolate between the previous frame and the current frame.
-	int frame = Animation::search(frames, time);
+	int frame = search(time);
 	float percent = getCurvePercent(time, frame);
 	Vector<float> &prevVertices = vertices[frame];
 	Vector<float> &nextVertices = vertices[frame + 1];
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated July 28, 2023. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2023, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software or
+ * otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THE
+ * SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <spine/EventBuffer.h>
+
+using namespace spine;
+
+EventBuffer::EventBuffer(size_t capacity) : _mask(0), _head(0), _tail(0), _dropped(0) {
+	size_t size = 1;
+	while (size < capacity) size <<= 1;
+	EventRecord empty = {EventType_Start, 0, NULL, NULL, NULL};
+	_records.setSize(size, empty);
+	_mask = size - 1;
+}
+
+EventBuffer::~EventBuffer() {
+}
+
+void EventBuffer::add(EventType type, TrackEntry *entry, Event *event) {
+	EventRecord record = {type, entry->getTrackIndex(), entry->getAnimation(), entry, event};
+	if (type == EventType_Dispose) {
+		// Keep the order of Dispose records, a later one must not overtake pending ones.
+		if (_pending.size() > 0 || !add(record)) _pending.add(record);
+	} else if (!add(record))
+		_dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool EventBuffer::add(const EventRecord &record) {
+	// Only the adding thread writes _tail, only the draining thread writes _head.
+	size_t tail = _tail.load(std::memory_order_relaxed);
+	if (tail - _head.load(std::memory_order_acquire) > _mask) return false;
+	_records[tail & _mask] = record;
+	_tail.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+void EventBuffer::flush() {
+	while (_pending.size() > 0 && add(_pending[0]))
+		_pending.removeAt(0);
+}
+
+size_t EventBuffer::drain(EventRecord *records, size_t maxCount) {
+	size_t head = _head.load(std::memory_order_relaxed);
+	size_t count = _tail.load(std::memory_order_acquire) - head;
+	if (count > maxCount) count = maxCount;
+	for (size_t i = 0; i < count; i++)
+		records[i] = _records[(head + i) & _mask];
+	_head.store(head + count, std::memory_order_release);
+	return count;
+}
+
+size_t EventBuffer::size() {
+	return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+}
+
+size_t EventBuffer::getCapacity() {
+	return _records.size();
+}
+
+size_t EventBuffer::getDroppedCount() {
+	return _dropped.load(std::memory_order_relaxed);
+}
+
+void EventBuffer::resetDroppedCount() {
+	_dropped.store(0, std::memory_order_relaxed);
+}
+
+size_t EventBuffer::getPendingCount() {
+	return _pending.size();
+}
@@ -78,7 +78,7 @@ void EventTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	if (lastTime < _frames[0]) {
 		i = 0;
 	} else {
-		i = Animation::search(_frames, lastTime) + 1;
+		i = search(lastTime) + 1;
 		float frameTime = _frames[i];
 		while (i > 0) {
 			// Fire multiple events with the same i.
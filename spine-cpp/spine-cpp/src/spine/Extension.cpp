@@ -32,6 +32,23 @@
 
 #include <assert.h>
 
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#define SPINE_MAP_FILE
+#elif (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SPINE_MAP_FILE
+#endif
+
 using namespace spine;
 
 SpineExtension *SpineExtension::_instance = NULL;
@@ -43,10 +60,13 @@ void SpineExtension::setInstance(SpineExtension *inValue) {
 }
 
 SpineExtension *SpineExtension::getInstance() {
-	if (!_instance) _instance = spine::getDefaultExtension();
-	assert(_instance);
+	if (_instance) return _instance;
+
+	// Initialized only once, even when first called from multiple threads.
+	static SpineExtension *defaultExtension = spine::getDefaultExtension();
+	assert(defaultExtension);
 
-	return _instance;
+	return defaultExtension;
 }
 
 SpineExtension::~SpineExtension() {
@@ -123,5 +143,51 @@ char *DefaultSpineExtension::_readFile(const String &path, int *length) {
 #endif
 }
 
+const char *DefaultSpineExtension::_mapFile(const String &path, int *length) {
+#if defined(SPINE_MAP_FILE) && defined(_WIN32)
+	HANDLE file = CreateFileA(path.buffer(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return 0;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 || size.QuadPart > 0x7fffffff) {
+		CloseHandle(file);
+		return 0;
+	}
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping) return 0;
+	const char *data = (const char *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!data) return 0;
+	*length = (int) size.QuadPart;
+	return data;
+#elif defined(SPINE_MAP_FILE)
+	int file = open(path.buffer(), O_RDONLY);
+	if (file < 0) return 0;
+	struct stat info;
+	if (fstat(file, &info) != 0 || info.st_size == 0 || info.st_size > 0x7fffffff) {
+		close(file);
+		return 0;
+	}
+	void *data = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (data == MAP_FAILED) return 0;
+	*length = (int) info.st_size;
+	return (const char *) data;
+#else
+	return SpineExtension::_mapFile(path, length);
+#endif
+}
+
+void DefaultSpineExtension::_unmapFile(const char *data, int length) {
+#if defined(SPINE_MAP_FILE) && defined(_WIN32)
+	SP_UNUSED(length);
+	UnmapViewOfFile(data);
+#elif defined(SPINE_MAP_FILE)
+	munmap((void *) data, (size_t) length);
+#else
+	SpineExtension::_unmapFile(data, length);
+#endif
+}
+
 DefaultSpineExtension::DefaultSpineExtension() : SpineExtension() {
 }
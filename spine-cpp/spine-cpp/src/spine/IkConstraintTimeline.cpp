@@ -80,7 +80,7 @@ void IkConstraintTimeline::apply(Skeleton &skeleton, float lastTime, float time,
 	}
 
 	float mix = 0, softness = 0;
-	int i = Animation::search(_frames, time, IkConstraintTimeline::ENTRIES);
+	int i = search(time, IkConstraintTimeline::ENTRIES);
 	int curveType = (int) _curves[i / IkConstraintTimeline::ENTRIES];
 	switch (curveType) {
 		case IkConstraintTimeline::LINEAR: {
@@ -76,6 +76,6 @@ void InheritTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vect
 		if (blend == MixBlend_Setup || blend == MixBlend_First) bone->_inherit = bone->_data.getInherit();
 		return;
 	}
-	int idx = Animation::search(_frames, time, ENTRIES) + INHERIT;
+	int idx = search(time, ENTRIES) + INHERIT;
 	bone->_inherit = static_cast<Inherit>(_frames[idx]);
 }
@@ -35,11 +35,15 @@ THE SOFTWARE.
 #endif
 
 #include <spine/Json.h>
+#include <spine/BlockAllocator.h>
 #include <spine/Extension.h>
+#include <spine/HashMap.h>
 #include <spine/SpineString.h>
 
 #include <assert.h>
 #include <math.h>
+#include <stdint.h>
+#include <string.h>
 
 using namespace spine;
 
@@ -51,9 +55,33 @@ const int Json::JSON_STRING = 4;
 const int Json::JSON_ARRAY = 5;
 const int Json::JSON_OBJECT = 6;
 
-const char *Json::_error = NULL;
+/* Per thread, so documents can be parsed concurrently. */
+static thread_local const char *_error = NULL;
+
+/* The allocator of the document parsed with indexing, or NULL. Its items, names, strings and hash tables are allocated
+ * from it, and its root deletes it at once. */
+static thread_local BlockAllocator *_indexAllocator = NULL;
+
+static Json *newItem() {
+	if (_indexAllocator) return new (_indexAllocator->allocate<Json>(1)) Json(NULL);
+	return new (__FILE__, __LINE__) Json(NULL);
+}
+
+/* Objects parsed with indexing that have at most this many items are searched linearly. */
+static const int maxUnindexedItems = 8;
+
+/* The _index of objects parsed with indexing that have too few items for a hash table. */
+static Json *unindexed = NULL;
+
+/* The hash table of an object has a power of 2 size, at least twice the number of items. */
+static size_t indexSize(int items) {
+	size_t size = 1;
+	while (size < (size_t) items * 2) size <<= 1;
+	return size;
+}
 
 Json *Json::getItem(Json *object, const char *string) {
+	if (object->_index) return getIndexedItem(object, string);
 	Json *c = object->_child;
 	while (c && json_strcasecmp(c->_name, string)) {
 		c = c->_next;
@@ -61,6 +89,35 @@ Json *Json::getItem(Json *object, const char *string) {
 	return c;
 }
 
+Json *Json::getIndexedItem(Json *object, const char *string) {
+	if (object->_index == &unindexed) {
+		Json *c = object->_child;
+		while (c && strcmp(c->_name, string)) c = c->_next;
+		return c;
+	}
+	size_t mask = indexSize(object->_size) - 1;
+	for (size_t i = hashString(string) & mask;; i = (i + 1) & mask) {
+		Json *c = object->_index[i];
+		if (!c || !strcmp(c->_name, string)) return c;
+	}
+}
+
+void Json::buildIndex(Json *item) {
+	if (item->_size <= maxUnindexedItems) {
+		item->_index = &unindexed;
+		return;
+	}
+	size_t mask = indexSize(item->_size) - 1;
+	item->_index = _indexAllocator->allocate<Json *>(mask + 1);
+	memset(item->_index, 0, sizeof(Json *) * (mask + 1));
+	/* Items are added in order and probing stops at the first match, so getItem() finds the first of duplicate names. */
+	for (Json *c = item->_child; c; c = c->_next) {
+		size_t i = hashString(c->_name) & mask;
+		while (item->_index[i]) i = (i + 1) & mask;
+		item->_index[i] = c;
+	}
+}
+
 Json *Json::getItem(Json *object, int childIndex) {
 	Json *current = object->_child;
 	while (current != NULL && childIndex > 0) {
@@ -107,7 +164,10 @@ const char *Json::getError() {
 	return _error;
 }
 
-Json::Json(const char *value) : _next(NULL),
+Json::Json(const char *value) : Json(value, false) {
+}
+
+Json::Json(const char *value, bool indexed) : _next(NULL),
 #if SPINE_JSON_HAVE_PREV
 								_prev(NULL),
 #endif
@@ -117,15 +177,30 @@ Json::Json(const char *value) : _next(NULL),
 								_valueString(NULL),
 								_valueInt(0),
 								_valueFloat(0),
-								_name(NULL) {
+								_name(NULL),
+								_index(NULL),
+								_allocator(NULL) {
 	if (value) {
-		value = parseValue(this, skip(value));
+		if (indexed) {
+			/* The items of the example skeletons need 6 to 12 times the size of the JSON, so a few blocks are added. */
+			_allocator = new (__FILE__, __LINE__) BlockAllocator((int) strlen(value) * 4);
+			_indexAllocator = _allocator;
+			value = parseValue(this, skip(value));
+			_indexAllocator = NULL;
+		} else {
+			value = parseValue(this, skip(value));
+		}
 
 		assert(value);
 	}
 }
 
 Json::~Json() {
+	if (_allocator) {
+		delete _allocator;
+		return;
+	}
+
 	spine::Json *curr = NULL;
 	spine::Json *next = _child;
 	do {
@@ -238,7 +313,11 @@ const char *Json::parseString(Json *item, const char *str) {
 		}
 	}
 
-	out = SpineExtension::alloc<char>(len + 1, __FILE__, __LINE__); /* The length needed for the string, roughly. */
+	/* The length needed for the string, roughly. */
+	if (_indexAllocator)
+		out = _indexAllocator->allocate<char>(len + 1);
+	else
+		out = SpineExtension::alloc<char>(len + 1, __FILE__, __LINE__);
 	if (!out) {
 		return 0;
 	}
@@ -337,64 +416,76 @@ const char *Json::parseString(Json *item, const char *str) {
 	return ptr;
 }
 
+/* Powers of 10 exactly representable as doubles. */
+static const double powersOf10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+									1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/* Significant digits are accumulated exactly up to this many, more digits only scale the number. */
+static const int maxMantissaDigits = 19;
+
 const char *Json::parseNumber(Json *item, const char *num) {
-	double result = 0.0;
-	int negative = 0;
-	char *ptr = (char *) num;
+	const char *ptr = num;
+	bool negative = false;
+	uint64_t mantissa = 0;
+	int digits = 0;
+	int exponent = 0;
 
 	if (*ptr == '-') {
-		negative = -1;
+		negative = true;
 		++ptr;
 	}
 
 	while (*ptr >= '0' && *ptr <= '9') {
-		result = result * 10.0 + (*ptr - '0');
+		if (digits < maxMantissaDigits) {
+			mantissa = mantissa * 10 + (*ptr - '0');
+			if (mantissa) digits++;
+		} else {
+			exponent++;
+		}
 		++ptr;
 	}
 
 	if (*ptr == '.') {
-		double fraction = 0.0;
-		int n = 0;
 		++ptr;
-
 		while (*ptr >= '0' && *ptr <= '9') {
-			fraction = (fraction * 10.0) + (*ptr - '0');
+			if (digits < maxMantissaDigits) {
+				mantissa = mantissa * 10 + (*ptr - '0');
+				if (mantissa) digits++;
+				exponent--;
+			}
 			++ptr;
-			++n;
 		}
-		result += fraction / pow(10.0, n);
-	}
-
-	if (negative) {
-		result = -result;
 	}
 
 	if (*ptr == 'e' || *ptr == 'E') {
-		double exponent = 0;
-		int expNegative = 0;
+		int value = 0;
+		bool expNegative = false;
 		++ptr;
 
 		if (*ptr == '-') {
-			expNegative = -1;
+			expNegative = true;
 			++ptr;
 		} else if (*ptr == '+') {
 			++ptr;
 		}
 
 		while (*ptr >= '0' && *ptr <= '9') {
-			exponent = (exponent * 10.0) + (*ptr - '0');
+			if (value < 10000) value = value * 10 + (*ptr - '0');
 			++ptr;
 		}
-
-		if (expNegative) {
-			result = result / pow(10, exponent);
-		} else {
-			result = result * pow(10, exponent);
-		}
+		exponent += expNegative ? -value : value;
 	}
 
 	if (ptr != num) {
-		/* Parse success, number found. */
+		/* Parse success, number found. A mantissa of at most 2^53 and a power of 10 up to 1e22 are exact doubles, so
+		 * a single multiplication or division rounds correctly (Clinger's fast path), which covers the numbers of
+		 * exported skeletons. Other numbers are scaled with pow(), which may be off by a unit in the last place. */
+		double result = (double) mantissa;
+		if (mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22)
+			result = exponent < 0 ? result / powersOf10[-exponent] : result * powersOf10[exponent];
+		else if (mantissa != 0)
+			result = exponent < 0 ? result / pow(10.0, -exponent) : result * pow(10.0, exponent);
+		if (negative) result = -result;
 		item->_valueFloat = (float) result;
 		item->_valueInt = (int) result;
 		item->_type = JSON_NUMBER;
@@ -422,7 +513,7 @@ const char *Json::parseArray(Json *item, const char *value) {
 		return value + 1; /* empty array. */
 	}
 
-	item->_child = child = new (__FILE__, __LINE__) Json(NULL);
+	item->_child = child = newItem();
 	if (!item->_child) {
 		return NULL; /* memory fail */
 	}
@@ -436,7 +527,7 @@ const char *Json::parseArray(Json *item, const char *value) {
 	item->_size = 1;
 
 	while (*value == ',') {
-		Json *new_item = new (__FILE__, __LINE__) Json(NULL);
+		Json *new_item = newItem();
 		if (!new_item) {
 			return NULL; /* memory fail */
 		}
@@ -475,10 +566,11 @@ const char *Json::parseObject(Json *item, const char *value) {
 	item->_type = JSON_OBJECT;
 	value = skip(value + 1);
 	if (*value == '}') {
+		if (_indexAllocator) buildIndex(item);
 		return value + 1; /* empty array. */
 	}
 
-	item->_child = child = new (__FILE__, __LINE__) Json(NULL);
+	item->_child = child = newItem();
 	if (!item->_child) {
 		return NULL;
 	}
@@ -501,7 +593,7 @@ const char *Json::parseObject(Json *item, const char *value) {
 	item->_size = 1;
 
 	while (*value == ',') {
-		Json *new_item = new (__FILE__, __LINE__) Json(NULL);
+		Json *new_item = newItem();
 		if (!new_item) {
 			return NULL; /* memory fail */
 		}
@@ -529,6 +621,7 @@ const char *Json::parseObject(Json *item, const char *value) {
 	}
 
 	if (*value == '}') {
+		if (_indexAllocator) buildIndex(item);
 		return value + 1; /* end of array */
 	}
 
@@ -557,3 +650,140 @@ int Json::json_strcasecmp(const char *s1, const char *s2) {
 		}
 	}
 }
+
+JsonReader::JsonReader(const char *json) : _position(Json::skip(json)), _name(NULL), _first(false) {
+}
+
+JsonReader::~JsonReader() {
+	if (_name) SpineExtension::free(_name, __FILE__, __LINE__);
+}
+
+bool JsonReader::beginArray() {
+	return begin('[', ']');
+}
+
+bool JsonReader::beginObject() {
+	return begin('{', '}');
+}
+
+bool JsonReader::begin(char open, char close) {
+	if (!_position) return false;
+	if (*_position != open) {
+		fail(_position);
+		return false;
+	}
+	_position++;
+	_stack.add(close);
+	_first = true;
+	return true;
+}
+
+bool JsonReader::next() {
+	if (!_position || _stack.size() == 0) return false;
+	char close = _stack[_stack.size() - 1];
+	const char *value = Json::skip(_position);
+	if (*value == close) {
+		_stack.removeAt(_stack.size() - 1);
+		_position = value + 1;
+		_first = false;
+		return false;
+	}
+	if (!_first) {
+		if (*value != ',') {
+			fail(value);
+			return false;
+		}
+		value = Json::skip(value + 1);
+	}
+	_first = false;
+	if (close == '}') {
+		Json name(NULL);
+		value = Json::skip(Json::parseString(&name, value));
+		if (!value || *value != ':') {
+			fail(value);
+			return false;
+		}
+		if (_name) SpineExtension::free(_name, __FILE__, __LINE__);
+		_name = (char *) name._valueString;
+		name._valueString = NULL;
+		value = Json::skip(value + 1);
+	}
+	_position = value;
+	return true;
+}
+
+Json *JsonReader::readValue() {
+	if (!_position) return NULL;
+	Json *item = new (__FILE__, __LINE__) Json(NULL);
+	const char *end = Json::parseValue(item, _position);
+	if (!end) {
+		delete item;
+		_position = NULL;
+		return NULL;
+	}
+	if (_stack.size() > 0 && _stack[_stack.size() - 1] == '}') {
+		item->_name = _name;
+		_name = NULL;
+	}
+	_position = end;
+	return item;
+}
+
+/* Returns the position after the closing quote of a string, given the position after its opening quote. */
+static const char *skipString(const char *value) {
+	while (true) {
+		value += strcspn(value, "\"\\");
+		if (*value == '\"') return value + 1;
+		if (!*value || !value[1]) return NULL;
+		value += 2;
+	}
+}
+
+void JsonReader::skipValue() {
+	const char *value = _position;
+	if (!value) return;
+	if (*value == '\"') {
+		value = skipString(value + 1);
+	} else if (*value == '{' || *value == '[') {
+		/* Only the characters that change the nesting are visited, strcspn() skips the others quickly. */
+		int depth = 0;
+		do {
+			value += strcspn(value, "\"{}[]");
+			char c = *value++;
+			if (c == '\"')
+				value = skipString(value);
+			else if (c == '{' || c == '[')
+				depth++;
+			else if (c == '}' || c == ']')
+				depth--;
+			else
+				value = NULL;
+		} while (value && depth > 0);
+	} else {
+		/* A number, true, false or null. */
+		while (*value && *value != ',' && *value != '}' && *value != ']' && (unsigned char) *value > 32) value++;
+	}
+	if (!value)
+		fail(_position);
+	else
+		_position = value;
+}
+
+const char *JsonReader::getName() {
+	return _name;
+}
+
+const char *JsonReader::getPosition() {
+	return _position;
+}
+
+void JsonReader::setPosition(const char *position) {
+	_position = position;
+	_stack.clear();
+	_first = false;
+}
+
+void JsonReader::fail(const char *position) {
+	if (position) _error = position;
+	_position = NULL;
+}
@@ -29,6 +29,14 @@
 
 #include <spine/MeshAttachment.h>
 
+#include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/Simd.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+
+#include <float.h>
+
 using namespace spine;
 
 RTTI_IMPL(MeshAttachment, VertexAttachment)
@@ -168,6 +176,7 @@ void MeshAttachment::setParentMesh(MeshAttachment *inValue) {
 		_bones.clearAndAddAll(inValue->_bones);
 		_vertices.clearAndAddAll(inValue->_vertices);
 		_worldVerticesLength = inValue->_worldVerticesLength;
+		packWeights();
 		_regionUVs.clearAndAddAll(inValue->_regionUVs);
 		_triangles.clearAndAddAll(inValue->_triangles);
 		_hullLength = inValue->_hullLength;
@@ -211,6 +220,7 @@ Attachment *MeshAttachment::copy() {
 	copy->_color.set(_color);
 
 	copyTo(copy);
+	copy->packWeights();
 	copy->_regionUVs.clearAndAddAll(_regionUVs);
 	copy->_uvs.clearAndAddAll(_uvs);
 	copy->_triangles.clearAndAddAll(_triangles);
@@ -237,5 +247,221 @@ MeshAttachment *MeshAttachment::newLinkedMesh() {
 void MeshAttachment::computeWorldVertices(Slot &slot, size_t start, size_t count, float *worldVertices, size_t offset,
 										  size_t stride) {
 	if (_sequence) _sequence->apply(&slot, this);
+	if (start == 0 && count == _worldVerticesLength && _weightCounts.size() > 0) {
+		computeWeightedWorldVertices(slot, worldVertices, offset, stride);
+		return;
+	}
 	VertexAttachment::computeWorldVertices(slot, start, count, worldVertices, offset, stride);
 }
+
+// The most bones a packed mesh can use, so their transforms fit on the stack.
+static const int MAX_WEIGHT_BONES = 128;
+
+void MeshAttachment::packWeights() {
+	updateBounds();
+	_weightBones.clear();
+	_weightCounts.clear();
+	_weightValues.clear();
+	_weightIndices.clear();
+	if (_bones.size() == 0) return;
+
+	// Find the start of each vertex in the bones and vertices arrays, and the bones used by the mesh.
+	size_t vertexCount = _worldVerticesLength >> 1;
+	Vector<int> vertexBones, vertexWeights, boneToWeightBone;
+	vertexBones.setSize(vertexCount, 0);
+	vertexWeights.setSize(vertexCount, 0);
+	for (size_t i = 0, v = 0, b = 0; i < vertexCount; i++) {
+		if (v >= _bones.size()) return;
+		int n = _bones[v];
+		vertexBones[i] = (int) v;
+		vertexWeights[i] = (int) b;
+		for (size_t ii = v + 1, nn = v + 1 + n; ii < nn; ii++) {
+			int bone = _bones[ii];
+			if ((int) boneToWeightBone.size() <= bone) boneToWeightBone.setSize(bone + 1, -1);
+			if (boneToWeightBone[bone] == -1) {
+				if ((int) _weightBones.size() == MAX_WEIGHT_BONES) {
+					_weightBones.clear();
+					return;
+				}
+				boneToWeightBone[bone] = (int) _weightBones.size();
+				_weightBones.add(bone);
+			}
+		}
+		v += n + 1;
+		b += n;
+	}
+
+	// Each group of 4 vertices has as many weights as its vertex with the most weights. For each weight there are 4 x, 4 y,
+	// and 4 weight values, and 4 bone indices and 4 deform offsets. Unused lanes have a weight of 0.
+	size_t groupCount = (vertexCount + 3) >> 2;
+	_weightCounts.setSize(groupCount, 0);
+	for (size_t group = 0; group < groupCount; group++) {
+		int count = 0;
+		for (size_t lane = 0, i = group << 2; lane < 4 && i < vertexCount; lane++, i++)
+			count = MathUtil::max(count, _bones[vertexBones[i]]);
+		_weightCounts[group] = count;
+		for (int weight = 0; weight < count; weight++) {
+			size_t values = _weightValues.size(), indices = _weightIndices.size();
+			_weightValues.setSize(values + 12, 0);
+			_weightIndices.setSize(indices + 8, 0);
+			for (size_t lane = 0, i = group << 2; lane < 4 && i < vertexCount; lane++, i++) {
+				int v = vertexBones[i];
+				if (weight >= _bones[v]) continue;
+				int b = vertexWeights[i] + weight;
+				_weightValues[values + lane] = _vertices[b * 3];
+				_weightValues[values + 4 + lane] = _vertices[b * 3 + 1];
+				_weightValues[values + 8 + lane] = _vertices[b * 3 + 2];
+				_weightIndices[indices + lane] = boneToWeightBone[_bones[v + 1 + weight]];
+				_weightIndices[indices + 4 + lane] = b << 1;
+			}
+		}
+	}
+}
+
+static void addBounds(Vector<float> &bounds, size_t index, float x, float y) {
+	float *b = bounds.buffer() + (index << 2);
+	if (x < b[0]) b[0] = x;
+	if (y < b[1]) b[1] = y;
+	if (x > b[2]) b[2] = x;
+	if (y > b[3]) b[3] = y;
+}
+
+/// Expands the world AABB to contain the AABB given in the bone's space.
+static void addWorldBounds(Bone &bone, float left, float bottom, float right, float top, float &minX, float &minY,
+						   float &maxX, float &maxY) {
+	float centerX = (left + right) * 0.5f, centerY = (bottom + top) * 0.5f;
+	float extentX = (right - left) * 0.5f, extentY = (top - bottom) * 0.5f;
+	float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
+	float x = centerX * a + centerY * b + bone.getWorldX(), y = centerX * c + centerY * d + bone.getWorldY();
+	float ex = MathUtil::abs(a) * extentX + MathUtil::abs(b) * extentY;
+	float ey = MathUtil::abs(c) * extentX + MathUtil::abs(d) * extentY;
+	minX = MathUtil::min(minX, x - ex);
+	minY = MathUtil::min(minY, y - ey);
+	maxX = MathUtil::max(maxX, x + ex);
+	maxY = MathUtil::max(maxY, y + ey);
+}
+
+void MeshAttachment::updateBounds() {
+	_boundsBones.clear();
+	_bounds.clear();
+	if (_bones.size() == 0) {
+		if (_vertices.size() < 2) return;
+		_bounds.add(_vertices[0]);
+		_bounds.add(_vertices[1]);
+		_bounds.add(_vertices[0]);
+		_bounds.add(_vertices[1]);
+		for (size_t i = 2, n = _vertices.size() - 1; i < n; i += 2)
+			addBounds(_bounds, 0, _vertices[i], _vertices[i + 1]);
+		return;
+	}
+
+	// The bounds of the vertex positions relative to each bone.
+	Vector<int> boneToBounds;
+	for (size_t v = 0, b = 0, n = _bones.size(); v < n;) {
+		int count = _bones[v++];
+		for (int end = (int) v + count; (int) v < end && v < n; v++, b += 3) {
+			int bone = _bones[v];
+			if ((int) boneToBounds.size() <= bone) boneToBounds.setSize(bone + 1, -1);
+			if (boneToBounds[bone] == -1) {
+				boneToBounds[bone] = (int) _boundsBones.size();
+				_boundsBones.add(bone);
+				_bounds.add(FLT_MAX);
+				_bounds.add(FLT_MAX);
+				_bounds.add(-FLT_MAX);
+				_bounds.add(-FLT_MAX);
+			}
+			addBounds(_bounds, boneToBounds[bone], _vertices[b], _vertices[b + 1]);
+		}
+	}
+}
+
+void MeshAttachment::computeBounds(Slot &slot, float &minX, float &minY, float &maxX, float &maxY) {
+	Vector<float> &deform = slot.getDeform();
+	if (_boundsBones.size() == 0) {
+		float localBounds[4];
+		float *bounds = _bounds.buffer();
+		if (deform.size() > 1) {
+			// The deform replaces the vertices.
+			localBounds[0] = localBounds[2] = deform[0];
+			localBounds[1] = localBounds[3] = deform[1];
+			for (size_t i = 2, n = deform.size() - 1; i < n; i += 2) {
+				float x = deform[i], y = deform[i + 1];
+				localBounds[0] = MathUtil::min(localBounds[0], x);
+				localBounds[1] = MathUtil::min(localBounds[1], y);
+				localBounds[2] = MathUtil::max(localBounds[2], x);
+				localBounds[3] = MathUtil::max(localBounds[3], y);
+			}
+			bounds = localBounds;
+		} else if (_bounds.size() == 0)
+			return;
+		addWorldBounds(slot.getBone(), bounds[0], bounds[1], bounds[2], bounds[3], minX, minY, maxX, maxY);
+		return;
+	}
+
+	// The deform offsets each bone relative position, so the bounds are expanded by the range of the offsets.
+	float deformMinX = 0, deformMinY = 0, deformMaxX = 0, deformMaxY = 0;
+	for (size_t i = 0, n = deform.size() > 0 ? deform.size() - 1 : 0; i < n; i += 2) {
+		deformMinX = MathUtil::min(deformMinX, deform[i]);
+		deformMinY = MathUtil::min(deformMinY, deform[i + 1]);
+		deformMaxX = MathUtil::max(deformMaxX, deform[i]);
+		deformMaxY = MathUtil::max(deformMaxY, deform[i + 1]);
+	}
+
+	// A weighted vertex is a weighted average of its positions transformed by each bone, so it lies within the union of
+	// the transformed bounds.
+	Vector<Bone *> &skeletonBones = slot.getBone().getSkeleton().getBones();
+	for (size_t i = 0, n = _boundsBones.size(); i < n; i++) {
+		float *bounds = _bounds.buffer() + (i << 2);
+		addWorldBounds(*skeletonBones[_boundsBones[i]], bounds[0] + deformMinX, bounds[1] + deformMinY,
+					   bounds[2] + deformMaxX, bounds[3] + deformMaxY, minX, minY, maxX, maxY);
+	}
+}
+
+void MeshAttachment::computeWeightedWorldVertices(Slot &slot, float *worldVertices, size_t offset, size_t stride) {
+	// Each bone's transform is stored as two rows: a, b, worldX and c, d, worldY.
+	Vector<Bone *> &skeletonBones = slot.getBone().getSkeleton().getBones();
+	float rowsX[MAX_WEIGHT_BONES * 4], rowsY[MAX_WEIGHT_BONES * 4];
+	for (size_t i = 0, n = _weightBones.size(); i < n; i++) {
+		Bone *bone = skeletonBones[_weightBones[i]];
+		float *rowX = rowsX + (i << 2), *rowY = rowsY + (i << 2);
+		rowX[0] = bone->_a;
+		rowX[1] = bone->_b;
+		rowX[2] = bone->_worldX;
+		rowX[3] = 0;
+		rowY[0] = bone->_c;
+		rowY[1] = bone->_d;
+		rowY[2] = bone->_worldY;
+		rowY[3] = 0;
+	}
+
+	Vector<float> &deformArray = slot.getDeform();
+	const float *deform = deformArray.size() > 0 ? deformArray.buffer() : NULL;
+	const float *values = _weightValues.buffer();
+	const int *indices = _weightIndices.buffer();
+	float lanesX[4], lanesY[4];
+	size_t vertexCount = _worldVerticesLength >> 1;
+	for (size_t group = 0, groupCount = _weightCounts.size(), w = offset; group < groupCount; group++) {
+		Float4 wx = Simd::zero(), wy = Simd::zero();
+		for (int weight = 0, n = _weightCounts[group]; weight < n; weight++, values += 12, indices += 8) {
+			Float4 vx = Simd::load(values), vy = Simd::load(values + 4);
+			if (deform) {
+				vx = Simd::add(vx, Simd::gather(deform, indices + 4));
+				vy = Simd::add(vy, Simd::gather(deform + 1, indices + 4));
+			}
+			Float4 a, b, c, d, worldX, worldY;
+			Simd::gatherRows(rowsX, indices, a, b, worldX);
+			Simd::gatherRows(rowsY, indices, c, d, worldY);
+			Float4 x = Simd::add(Simd::add(Simd::mul(vx, a), Simd::mul(vy, b)), worldX);
+			Float4 y = Simd::add(Simd::add(Simd::mul(vx, c), Simd::mul(vy, d)), worldY);
+			Float4 weights = Simd::load(values + 8);
+			wx = Simd::add(wx, Simd::mul(x, weights));
+			wy = Simd::add(wy, Simd::mul(y, weights));
+		}
+		Simd::store(lanesX, wx);
+		Simd::store(lanesY, wy);
+		for (size_t lane = 0, i = group << 2; lane < 4 && i < vertexCount; lane++, i++, w += stride) {
+			worldVertices[w] = lanesX[lane];
+			worldVertices[w + 1] = lanesY[lane];
+		}
+	}
+}
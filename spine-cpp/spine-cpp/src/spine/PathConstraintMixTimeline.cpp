@@ -78,7 +78,7 @@ void PathConstraintMixTimeline::apply(Skeleton &skeleton, float lastTime, float
 	}
 
 	float rotate, x, y;
-	int i = Animation::search(_frames, time, PathConstraintMixTimeline::ENTRIES);
+	int i = search(time, PathConstraintMixTimeline::ENTRIES);
 	int curveType = (int) _curves[i >> 2];
 	switch (curveType) {
 		case LINEAR: {
@@ -68,6 +68,9 @@ PhysicsConstraint::PhysicsConstraint(PhysicsConstraintData &data, Skeleton &skel
 	_active = false;
 	_remaining = 0;
 	_lastTime = 0;
+	_dampingFactor = 1;
+	_factorDamping = -1;
+	_factorStep = -1;
 }
 
 PhysicsConstraintData &PhysicsConstraint::getData() {
@@ -305,6 +308,15 @@ void PhysicsConstraint::setToSetupPose() {
 	_gravity = _data.getGravity();
 	_mix = _data.getMix();
 }
+float PhysicsConstraint::getDampingFactor(float step) {
+	if (_damping != _factorDamping || step != _factorStep) {
+		_dampingFactor = MathUtil::pow(_damping, 60 * step);
+		_factorDamping = _damping;
+		_factorStep = step;
+	}
+	return _dampingFactor;
+}
+
 void PhysicsConstraint::update(Physics physics) {
 	float mix = _mix;
 	if (mix == 0) return;
@@ -315,7 +327,6 @@ void PhysicsConstraint::update(Physics physics) {
 	bool scaleX = _data._scaleX > 0;
 
 	Bone *bone = _bone;
-	float l = bone->_data.getLength();
 
 	switch (physics) {
 		case Physics::Physics_None:
@@ -324,108 +335,20 @@ void PhysicsConstraint::update(Physics physics) {
 			reset();
 			// Fall through.
 		case Physics::Physics_Update: {
-			float delta = MathUtil::max(_skeleton.getTime() - _lastTime, 0.0f);
-			_remaining += delta;
-			_lastTime = _skeleton.getTime();
-
-			float bx = bone->_worldX, by = bone->_worldY;
-			if (_reset) {
-				_reset = false;
-				_ux = bx;
-				_uy = by;
-			} else {
-				float a = _remaining, i = _inertia, t = _data._step, f = _skeleton.getData()->getReferenceScale();
-				float qx = _data._limit * delta, qy = qx * MathUtil::abs(_skeleton.getScaleX());
-				qx *= MathUtil::abs(_skeleton.getScaleY());
+			float qx, qy;
+			int steps = beginUpdate(qx, qy);
+			if (steps != -1) {
 				if (x || y) {
-					if (x) {
-						float u = (_ux - bx) * i;
-						_xOffset += u > qx ? qx : u < -qx ? -qx
-														  : u;
-						_ux = bx;
-					}
-					if (y) {
-						float u = (_uy - by) * i;
-						_yOffset += u > qy ? qy : u < -qy ? -qy
-														  : u;
-						_uy = by;
-					}
-					if (a >= t) {
-						float d = MathUtil::pow(_damping, 60 * t);
-						float m = _massInverse * t, e = _strength, w = _wind * f, g = _gravity * f * (Bone::yDown ? -1 : 1);
-						do {
-							if (x) {
-								_xVelocity += (w - _xOffset * e) * m;
-								_xOffset += _xVelocity * t;
-								_xVelocity *= d;
-							}
-							if (y) {
-								_yVelocity -= (g + _yOffset * e) * m;
-								_yOffset += _yVelocity * t;
-								_yVelocity *= d;
-							}
-							a -= t;
-						} while (a >= t);
-					}
+					stepTranslation(steps);
 					if (x) bone->_worldX += _xOffset * mix * _data._x;
 					if (y) bone->_worldY += _yOffset * mix * _data._y;
 				}
-
 				if (rotateOrShearX || scaleX) {
-					float ca = MathUtil::atan2(bone->_c, bone->_a), c, s, mr = 0;
-					float dx = _cx - bone->_worldX, dy = _cy - bone->_worldY;
-					if (dx > qx)
-						dx = qx;
-					else if (dx < -qx)//
-						dx = -qx;
-					if (dy > qy)
-						dy = qy;
-					else if (dy < -qy)//
-						dy = -qy;
-					if (rotateOrShearX) {
-						mr = (_data._rotate + _data._shearX) * mix;
-						float r = MathUtil::atan2(dy + _ty, dx + _tx) - ca - _rotateOffset * mr;
-						_rotateOffset += (r - MathUtil::ceil(r * MathUtil::InvPi_2 - 0.5f) * MathUtil::Pi_2) * i;
-						r = _rotateOffset * mr + ca;
-						c = MathUtil::cos(r);
-						s = MathUtil::sin(r);
-						if (scaleX) {
-							r = l * bone->getWorldScaleX();
-							if (r > 0) _scaleOffset += (dx * c + dy * s) * i / r;
-						}
-					} else {
-						c = MathUtil::cos(ca);
-						s = MathUtil::sin(ca);
-						float r = l * bone->getWorldScaleX();
-						if (r > 0) _scaleOffset += (dx * c + dy * s) * i / r;
-					}
-					a = _remaining;
-					if (a >= t) {
-						float m = _massInverse * t, e = _strength, w = _wind, g = _gravity * (Bone::yDown ? -1 : 1), h = l / f;
-						float d = MathUtil::pow(_damping, 60 * t);
-						while (true) {
-							a -= t;
-							if (scaleX) {
-								_scaleVelocity += (w * c - g * s - _scaleOffset * e) * m;
-								_scaleOffset += _scaleVelocity * t;
-								_scaleVelocity *= d;
-							}
-							if (rotateOrShearX) {
-								_rotateVelocity -= ((w * s + g * c) * h + _rotateOffset * e) * m;
-								_rotateOffset += _rotateVelocity * t;
-								_rotateVelocity *= d;
-								if (a < t) break;
-								float r = _rotateOffset * mr + ca;
-								c = MathUtil::cos(r);
-								s = MathUtil::sin(r);
-							} else if (a < t)//
-								break;
-						}
-					}
+					float ca, c, s, mr;
+					beginRotation(qx, qy, ca, c, s, mr);
+					stepRotation(0, steps, steps, ca, c, s, mr);
 				}
-				_remaining = a;
 			}
-
 			_cx = bone->_worldX;
 			_cy = bone->_worldY;
 			break;
@@ -437,7 +360,143 @@ void PhysicsConstraint::update(Physics physics) {
 		}
 	}
 
-	if (rotateOrShearX) {
+	endUpdate(physics);
+}
+
+int PhysicsConstraint::beginUpdate(float &qx, float &qy) {
+	Bone *bone = _bone;
+	float delta = MathUtil::max(_skeleton.getTime() - _lastTime, 0.0f);
+	_remaining += delta;
+	_lastTime = _skeleton.getTime();
+
+	int maxSteps = _skeleton._maxPhysicsSteps;
+	if (maxSteps > 0 && _remaining >= _data._step * (maxSteps + 1)) {
+		_skeleton._physicsStepOverflows++;
+		if (_skeleton._physicsStepOverflow == PhysicsStepOverflow_Reset)
+			reset();
+		else
+			_remaining = _data._step * maxSteps + MathUtil::fmod(_remaining, _data._step);
+	}
+
+	float bx = bone->_worldX, by = bone->_worldY;
+	if (_reset) {
+		_reset = false;
+		_ux = bx;
+		_uy = by;
+		return -1;
+	}
+
+	bool x = _data._x > 0, y = _data._y > 0;
+	int steps = 0;
+	if (x || y || _data._rotate > 0 || _data._shearX > 0 || _data._scaleX > 0) {
+		float a = _remaining, t = _data._step;
+		for (; a >= t; a -= t)
+			steps++;
+		_remaining = a;
+		_skeleton._physicsSteps += steps;
+	}
+
+	qx = _data._limit * delta;
+	qy = qx * MathUtil::abs(_skeleton.getScaleX());
+	qx *= MathUtil::abs(_skeleton.getScaleY());
+	float i = _inertia;
+	if (x) {
+		float u = (_ux - bx) * i;
+		_xOffset += u > qx ? qx : u < -qx ? -qx
+										  : u;
+		_ux = bx;
+	}
+	if (y) {
+		float u = (_uy - by) * i;
+		_yOffset += u > qy ? qy : u < -qy ? -qy
+										  : u;
+		_uy = by;
+	}
+	return steps;
+}
+
+void PhysicsConstraint::stepTranslation(int steps) {
+	if (steps <= 0) return;
+	bool x = _data._x > 0, y = _data._y > 0;
+	float t = _data._step, f = _skeleton.getData()->getReferenceScale();
+	float d = getDampingFactor(t);
+	float m = _massInverse * t, e = _strength, w = _wind * f, g = _gravity * f * (Bone::yDown ? -1 : 1);
+	do {
+		if (x) {
+			_xVelocity += (w - _xOffset * e) * m;
+			_xOffset += _xVelocity * t;
+			_xVelocity *= d;
+		}
+		if (y) {
+			_yVelocity -= (g + _yOffset * e) * m;
+			_yOffset += _yVelocity * t;
+			_yVelocity *= d;
+		}
+	} while (--steps > 0);
+}
+
+void PhysicsConstraint::beginRotation(float qx, float qy, float &ca, float &c, float &s, float &mr) {
+	Bone *bone = _bone;
+	float i = _inertia, l = bone->_data.getLength();
+	ca = MathUtil::atan2(bone->_c, bone->_a);
+	mr = 0;
+	float dx = _cx - bone->_worldX, dy = _cy - bone->_worldY;
+	if (dx > qx)
+		dx = qx;
+	else if (dx < -qx)//
+		dx = -qx;
+	if (dy > qy)
+		dy = qy;
+	else if (dy < -qy)//
+		dy = -qy;
+	if (_data._rotate > 0 || _data._shearX > 0) {
+		mr = (_data._rotate + _data._shearX) * _mix;
+		float r = MathUtil::atan2(dy + _ty, dx + _tx) - ca - _rotateOffset * mr;
+		_rotateOffset += (r - MathUtil::ceil(r * MathUtil::InvPi_2 - 0.5f) * MathUtil::Pi_2) * i;
+		r = _rotateOffset * mr + ca;
+		c = MathUtil::cos(r);
+		s = MathUtil::sin(r);
+		if (_data._scaleX > 0) {
+			r = l * bone->getWorldScaleX();
+			if (r > 0) _scaleOffset += (dx * c + dy * s) * i / r;
+		}
+	} else {
+		c = MathUtil::cos(ca);
+		s = MathUtil::sin(ca);
+		float r = l * bone->getWorldScaleX();
+		if (r > 0) _scaleOffset += (dx * c + dy * s) * i / r;
+	}
+}
+
+void PhysicsConstraint::stepRotation(int from, int to, int steps, float ca, float c, float s, float mr) {
+	if (from >= to) return;
+	bool rotateOrShearX = _data._rotate > 0 || _data._shearX > 0, scaleX = _data._scaleX > 0;
+	float t = _data._step, f = _skeleton.getData()->getReferenceScale();
+	float m = _massInverse * t, e = _strength, w = _wind, g = _gravity * (Bone::yDown ? -1 : 1), h = _bone->_data.getLength() / f;
+	float d = getDampingFactor(t);
+	for (int i = from; i < to; i++) {
+		if (scaleX) {
+			_scaleVelocity += (w * c - g * s - _scaleOffset * e) * m;
+			_scaleOffset += _scaleVelocity * t;
+			_scaleVelocity *= d;
+		}
+		if (rotateOrShearX) {
+			_rotateVelocity -= ((w * s + g * c) * h + _rotateOffset * e) * m;
+			_rotateOffset += _rotateVelocity * t;
+			_rotateVelocity *= d;
+			if (i + 1 < steps) {
+				float r = _rotateOffset * mr + ca;
+				c = MathUtil::cos(r);
+				s = MathUtil::sin(r);
+			}
+		}
+	}
+}
+
+void PhysicsConstraint::endUpdate(Physics physics) {
+	Bone *bone = _bone;
+	float mix = _mix, l = bone->_data.getLength();
+	if (_data._rotate > 0 || _data._shearX > 0) {
 		float o = _rotateOffset * mix, s = 0, c = 0, a = 0;
 		if (_data._shearX > 0) {
 			float r = 0;
@@ -467,7 +526,7 @@ void PhysicsConstraint::update(Physics physics) {
 			bone->_d = s * a + c * bone->_d;
 		}
 	}
-	if (scaleX) {
+	if (_data._scaleX > 0) {
 		float s = 1 + _scaleOffset * mix * _data._scaleX;
 		bone->_a *= s;
 		bone->_c *= s;
@@ -89,7 +89,7 @@ void PhysicsConstraintResetTimeline::apply(Skeleton &skeleton, float lastTime, f
 		return;
 	if (time < _frames[0]) return;
 
-	if (lastTime < _frames[0] || time >= _frames[Animation::search(_frames, lastTime) + 1]) {
+	if (lastTime < _frames[0] || time >= _frames[search(lastTime) + 1]) {
 		if (constraint != nullptr)
 			constraint->reset();
 		else {
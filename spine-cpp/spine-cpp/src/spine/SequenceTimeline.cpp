@@ -81,7 +81,7 @@ void SequenceTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vec
 		return;
 	}
 
-	int i = Animation::search(frames, time, ENTRIES);
+	int i = search(time, ENTRIES);
 	float before = frames[i];
 	int modeAndIndex = (int) frames[i + MODE];
 	float delay = frames[i + DELAY];
@@ -52,6 +52,7 @@
 #include <spine/SkeletonClipping.h>
 
 #include <spine/ContainerUtil.h>
+#include <spine/Simd.h>
 
 #include <float.h>
 
@@ -59,7 +60,9 @@ using namespace spine;
 
 Skeleton::Skeleton(SkeletonData *skeletonData)
 	: _data(skeletonData), _skin(NULL), _color(1, 1, 1, 1), _scaleX(1),
-	  _scaleY(1), _x(0), _y(0), _time(0) {
+	  _scaleY(1), _x(0), _y(0), _time(0), _usePoseBuffer(false), _usePhysicsBatch(false), _dormant(false),
+	  _wakePhysics(Physics_None), _maxPhysicsSteps(0), _physicsStepOverflow(PhysicsStepOverflow_Discard),
+	  _physicsSteps(0), _physicsStepOverflows(0) {
 	_bones.ensureCapacity(_data->getBones().size());
 	for (size_t i = 0; i < _data->getBones().size(); ++i) {
 		BoneData *data = _data->getBones()[i];
@@ -211,6 +214,9 @@ continue_outer:
 	for (i = 0; i < n; ++i) {
 		sortBone(_bones[i]);
 	}
+
+	if (_usePhysicsBatch) updatePhysicsRuns();
+	if (_usePoseBuffer) updatePoseRuns();
 }
 
 void Skeleton::printUpdateCache() {
@@ -235,6 +241,14 @@ void Skeleton::printUpdateCache() {
 }
 
 void Skeleton::updateWorldTransform(Physics physics) {
+	if (_dormant) return;
+	if (_wakePhysics != Physics_None && physics != Physics_None) {
+		physics = _wakePhysics;
+		_wakePhysics = Physics_None;
+	}
+	_physicsSteps = 0;
+	_physicsStepOverflows = 0;
+
 	for (size_t i = 0, n = _bones.size(); i < n; i++) {
 		Bone *bone = _bones[i];
 		bone->_ax = bone->_x;
@@ -246,13 +260,482 @@ void Skeleton::updateWorldTransform(Physics physics) {
 		bone->_ashearY = bone->_shearY;
 	}
 
-	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
-		Updatable *updatable = _updateCache[i];
-		updatable->update(physics);
+	if (!_usePoseBuffer && !_usePhysicsBatch) {
+		for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
+			Updatable *updatable = _updateCache[i];
+			updatable->update(physics);
+		}
+		return;
+	}
+
+	for (size_t i = 0, n = _updateCache.size(), run = 0, physicsRun = 0; i < n;) {
+		if (run < _poseRuns.size() && (size_t) _poseRuns[run] == i) {
+			size_t end = (size_t) _poseRuns[run + 1];
+			updatePoseRun(i, end, physics);
+			i = end;
+			run += 2;
+		} else if (physicsRun < _physicsRuns.size() && (size_t) _physicsRuns[physicsRun] == i) {
+			size_t end = (size_t) _physicsRuns[physicsRun + 1];
+			updatePhysicsRun(i, end, physics);
+			i = end;
+			physicsRun += 2;
+		} else
+			_updateCache[i++]->update(physics);
+	}
+}
+
+void Skeleton::setUsePoseBuffer(bool usePoseBuffer) {
+	_usePoseBuffer = usePoseBuffer;
+	if (usePoseBuffer)
+		updatePoseRuns();
+	else {
+		_poseBuffer.clear();
+		_poseRuns.clear();
+		_poseRunBones.clear();
+		_poseRunParents.clear();
+	}
+}
+
+bool Skeleton::getUsePoseBuffer() {
+	return _usePoseBuffer;
+}
+
+void Skeleton::setUsePhysicsBatch(bool usePhysicsBatch) {
+	_usePhysicsBatch = usePhysicsBatch;
+	if (!usePhysicsBatch) {
+		_physicsRuns.clear();
+		_physicsBuffer.clear();
+		_physicsRunLanes.clear();
+	}
+	// Restores or changes the update cache order.
+	updateCache();
+}
+
+bool Skeleton::getUsePhysicsBatch() {
+	return _usePhysicsBatch;
+}
+
+void Skeleton::setDormant(bool dormant, Physics wakePhysics) {
+	if (_dormant && !dormant) {
+		// Properties which were keyed while dormant but aren't keyed anymore would otherwise keep stale values.
+		setToSetupPose();
+		_wakePhysics = wakePhysics;
+	}
+	_dormant = dormant;
+}
+
+bool Skeleton::isDormant() {
+	return _dormant;
+}
+
+int Skeleton::getMaxPhysicsSteps() {
+	return _maxPhysicsSteps;
+}
+
+void Skeleton::setMaxPhysicsSteps(int maxPhysicsSteps) {
+	_maxPhysicsSteps = maxPhysicsSteps;
+}
+
+PhysicsStepOverflow Skeleton::getPhysicsStepOverflow() {
+	return _physicsStepOverflow;
+}
+
+void Skeleton::setPhysicsStepOverflow(PhysicsStepOverflow physicsStepOverflow) {
+	_physicsStepOverflow = physicsStepOverflow;
+}
+
+int Skeleton::getPhysicsSteps() {
+	return _physicsSteps;
+}
+
+int Skeleton::getPhysicsStepOverflows() {
+	return _physicsStepOverflows;
+}
+
+// Pose buffer arrays, each with one float per bone.
+static const int POSE_LA = 0, POSE_LB = 1, POSE_LC = 2, POSE_LD = 3;
+static const int POSE_A = 4, POSE_B = 5, POSE_C = 6, POSE_D = 7, POSE_WORLD_X = 8, POSE_WORLD_Y = 9;
+static const int POSE_ARRAYS = 10;
+
+void Skeleton::updatePoseRuns() {
+	size_t boneCount = _bones.size(), n = _updateCache.size();
+	_poseBuffer.setSize(boneCount * POSE_ARRAYS, 0);
+	_poseRuns.clear();
+	_poseRunBones.setSize(n, -1);
+	_poseRunParents.setSize(n, -1);
+
+	// Find runs of at least two consecutive bones which have a parent. A parent updated outside of the run is stored with
+	// ~index, so its world transform is read from the bone rather than the pose buffer.
+	size_t i = 0;
+	while (i < n) {
+		size_t start = i;
+		for (; i < n; i++) {
+			Updatable *updatable = _updateCache[i];
+			if (!updatable->getRTTI().isExactly(Bone::rtti)) break;
+			Bone *bone = (Bone *) updatable;
+			if (!bone->_parent) break;
+			int parent = bone->_parent->_data.getIndex();
+			bool inRun = false;
+			for (size_t ii = start; ii < i; ii++) {
+				if (_poseRunBones[ii] == parent) {
+					inRun = true;
+					break;
+				}
+			}
+			_poseRunBones[i] = bone->_data.getIndex();
+			_poseRunParents[i] = inRun ? parent : ~parent;
+		}
+		if (i - start > 1) {
+			_poseRuns.add((int) start);
+			_poseRuns.add((int) i);
+		}
+		if (i == start) i++;
+	}
+}
+
+void Skeleton::updatePoseRun(size_t start, size_t end, Physics physics) {
+	size_t boneCount = _bones.size();
+	float *pose = _poseBuffer.buffer();
+	float *la = pose + POSE_LA * boneCount, *lb = pose + POSE_LB * boneCount;
+	float *lc = pose + POSE_LC * boneCount, *ld = pose + POSE_LD * boneCount;
+	float *a = pose + POSE_A * boneCount, *b = pose + POSE_B * boneCount;
+	float *c = pose + POSE_C * boneCount, *d = pose + POSE_D * boneCount;
+	float *worldX = pose + POSE_WORLD_X * boneCount, *worldY = pose + POSE_WORLD_Y * boneCount;
+	Updatable **cache = _updateCache.buffer();
+	int *runBones = _poseRunBones.buffer(), *runParents = _poseRunParents.buffer();
+
+	// Compute the local matrices, which don't depend on each other, and gather parents updated before the run.
+	for (size_t i = start; i < end; i++) {
+		Bone *bone = (Bone *) cache[i];
+		int index = runBones[i], parent = runParents[i];
+		// The same computation as Bone::updateWorldTransform(), so the world transforms are identical.
+		float rx = (bone->_arotation + bone->_ashearX) * MathUtil::Deg_Rad;
+		float ry = (bone->_arotation + 90 + bone->_ashearY) * MathUtil::Deg_Rad;
+		la[index] = MathUtil::cos(rx) * bone->_ascaleX;
+		lb[index] = MathUtil::cos(ry) * bone->_ascaleY;
+		lc[index] = MathUtil::sin(rx) * bone->_ascaleX;
+		ld[index] = MathUtil::sin(ry) * bone->_ascaleY;
+		if (parent < 0) {
+			Bone *parentBone = bone->_parent;
+			parent = ~parent;
+			a[parent] = parentBone->_a;
+			b[parent] = parentBone->_b;
+			c[parent] = parentBone->_c;
+			d[parent] = parentBone->_d;
+			worldX[parent] = parentBone->_worldX;
+			worldY[parent] = parentBone->_worldY;
+		}
+	}
+
+	// Multiply by the parent world transforms in update order.
+	for (size_t i = start; i < end; i++) {
+		Bone *bone = (Bone *) cache[i];
+		int index = runBones[i], parent = runParents[i];
+		if (parent < 0) parent = ~parent;
+		if (bone->_inherit != Inherit_Normal) {
+			bone->update(physics);
+		} else {
+			float pa = a[parent], pb = b[parent], pc = c[parent], pd = d[parent];
+			float x = bone->_ax, y = bone->_ay;
+			bone->_worldX = pa * x + pb * y + worldX[parent];
+			bone->_worldY = pc * x + pd * y + worldY[parent];
+			bone->_a = pa * la[index] + pb * lc[index];
+			bone->_b = pa * lb[index] + pb * ld[index];
+			bone->_c = pc * la[index] + pd * lc[index];
+			bone->_d = pc * lb[index] + pd * ld[index];
+		}
+		a[index] = bone->_a;
+		b[index] = bone->_b;
+		c[index] = bone->_c;
+		d[index] = bone->_d;
+		worldX[index] = bone->_worldX;
+		worldY[index] = bone->_worldY;
+	}
+}
+
+void Skeleton::updatePhysicsRuns() {
+	size_t n = _updateCache.size(), boneCount = _bones.size();
+	_physicsRuns.clear();
+
+	// Reorder each stretch of bones and physics constraints between other constraints by level, where an updatable's level
+	// is one more than the highest level of the updatables before it for the same bone, an ancestor or a descendant. An
+	// updatable only depends on those, so updatables with the same level are independent and the physics constraints of
+	// each level can be updated together after its bones. Bone levels store the highest level of the updatables for each
+	// bone, subtree levels for the bone or any descendant.
+	Vector<Updatable *> cache;
+	Vector<int> levels, boneLevels, subtreeLevels;
+	cache.ensureCapacity(n);
+	size_t i = 0;
+	while (i < n) {
+		size_t start = i, physicsCount = 0;
+		for (; i < n; i++) {
+			Updatable *updatable = _updateCache[i];
+			if (updatable->getRTTI().isExactly(PhysicsConstraint::rtti))
+				physicsCount++;
+			else if (!updatable->getRTTI().isExactly(Bone::rtti))
+				break;
+		}
+		if (physicsCount < 2) {
+			for (size_t ii = start; ii < i; ii++)
+				cache.add(_updateCache[ii]);
+		} else {
+			levels.setSize(i - start, 0);
+			boneLevels.setSize(boneCount, 0);
+			subtreeLevels.setSize(boneCount, 0);
+			for (size_t ii = 0; ii < boneCount; ii++) {
+				boneLevels[ii] = -1;
+				subtreeLevels[ii] = -1;
+			}
+			int maxLevel = 0;
+			for (size_t ii = start; ii < i; ii++) {
+				Updatable *updatable = _updateCache[ii];
+				Bone *bone = updatable->getRTTI().isExactly(Bone::rtti) ? (Bone *) updatable : ((PhysicsConstraint *) updatable)->_bone;
+				int level = subtreeLevels[bone->_data.getIndex()];
+				for (Bone *parent = bone->_parent; parent; parent = parent->_parent)
+					level = MathUtil::max(level, boneLevels[parent->_data.getIndex()]);
+				levels[ii - start] = ++level;
+				maxLevel = MathUtil::max(maxLevel, level);
+				boneLevels[bone->_data.getIndex()] = level;
+				for (; bone; bone = bone->_parent)
+					subtreeLevels[bone->_data.getIndex()] = MathUtil::max(subtreeLevels[bone->_data.getIndex()], level);
+			}
+			for (int level = 0; level <= maxLevel; level++) {
+				for (size_t ii = start; ii < i; ii++) {
+					if (levels[ii - start] == level && _updateCache[ii]->getRTTI().isExactly(Bone::rtti))
+						cache.add(_updateCache[ii]);
+				}
+				size_t runStart = cache.size();
+				for (size_t ii = start; ii < i; ii++) {
+					if (levels[ii - start] == level && !_updateCache[ii]->getRTTI().isExactly(Bone::rtti))
+						cache.add(_updateCache[ii]);
+				}
+				if (cache.size() - runStart > 1) {
+					_physicsRuns.add((int) runStart);
+					_physicsRuns.add((int) cache.size());
+				}
+			}
+		}
+		if (i < n) cache.add(_updateCache[i++]);
+	}
+	_updateCache.clearAndAddAll(cache);
+}
+
+// Physics buffer arrays. The limits have one float per constraint in the run. The others have one float per lane, which
+// are the constraints simulating steps, first for translation and then for rotation and scale. Offset and velocity 1 are
+// for x or scale, 2 for y or rotation.
+static const int PHYSICS_QX = 0, PHYSICS_QY = 1;
+static const int PHYSICS_OFFSET1 = 2, PHYSICS_VELOCITY1 = 3, PHYSICS_OFFSET2 = 4, PHYSICS_VELOCITY2 = 5;
+static const int PHYSICS_COS = 6, PHYSICS_SIN = 7, PHYSICS_MIX = 8, PHYSICS_ANGLE = 9;
+static const int PHYSICS_M = 10, PHYSICS_E = 11, PHYSICS_W = 12, PHYSICS_G = 13, PHYSICS_H = 14, PHYSICS_D = 15;
+static const int PHYSICS_T = 16;
+static const int PHYSICS_ARRAYS = 17;
+
+// Physics lane arrays. Steps has one int per constraint in the run, which is -2 for a constraint with a mix of 0 and -1 for
+// one which was reset. The others have one int per lane: the constraint index, the steps already simulated, and 1 if the
+// rotation is simulated.
+static const int PHYSICS_STEPS = 0, PHYSICS_LANES = 1, PHYSICS_DONE = 2, PHYSICS_ROTATE = 3;
+static const int PHYSICS_LANE_ARRAYS = 4;
+
+void Skeleton::updatePhysicsRun(size_t start, size_t end, Physics physics) {
+	Updatable **cache = _updateCache.buffer() + start;
+	size_t count = end - start;
+	if (physics != Physics_Update && physics != Physics_Reset) {
+		for (size_t i = 0; i < count; i++)
+			cache[i]->update(physics);
+		return;
+	}
+
+	size_t size = (count + 3) & ~(size_t) 3;
+	_physicsBuffer.setSize(size * PHYSICS_ARRAYS, 0);
+	_physicsRunLanes.setSize(size * PHYSICS_LANE_ARRAYS, 0);
+	float *buffer = _physicsBuffer.buffer();
+	float *qx = buffer + PHYSICS_QX * size, *qy = buffer + PHYSICS_QY * size;
+	float *offset1 = buffer + PHYSICS_OFFSET1 * size, *velocity1 = buffer + PHYSICS_VELOCITY1 * size;
+	float *offset2 = buffer + PHYSICS_OFFSET2 * size, *velocity2 = buffer + PHYSICS_VELOCITY2 * size;
+	float *cosines = buffer + PHYSICS_COS * size, *sines = buffer + PHYSICS_SIN * size;
+	float *mixes = buffer + PHYSICS_MIX * size, *angles = buffer + PHYSICS_ANGLE * size;
+	float *ms = buffer + PHYSICS_M * size, *es = buffer + PHYSICS_E * size, *ws = buffer + PHYSICS_W * size;
+	float *gs = buffer + PHYSICS_G * size, *hs = buffer + PHYSICS_H * size, *ds = buffer + PHYSICS_D * size;
+	float *ts = buffer + PHYSICS_T * size;
+	int *ints = _physicsRunLanes.buffer();
+	int *steps = ints + PHYSICS_STEPS * size, *lanes = ints + PHYSICS_LANES * size;
+	int *done = ints + PHYSICS_DONE * size, *rotates = ints + PHYSICS_ROTATE * size;
+	float f = _data->getReferenceScale(), yDown = Bone::yDown ? -1.0f : 1.0f;
+
+	// Accumulate the time and gather the constraints which simulate translation steps.
+	size_t laneCount = 0;
+	for (size_t i = 0; i < count; i++) {
+		PhysicsConstraint *constraint = (PhysicsConstraint *) cache[i];
+		if (constraint->_mix == 0) {
+			steps[i] = -2;
+			continue;
+		}
+		if (physics == Physics_Reset) constraint->reset();
+		steps[i] = constraint->beginUpdate(qx[i], qy[i]);
+		PhysicsConstraintData &data = constraint->_data;
+		if (steps[i] > 0 && (data._x > 0 || data._y > 0)) {
+			size_t lane = laneCount++;
+			float t = data._step;
+			lanes[lane] = (int) i;
+			offset1[lane] = constraint->_xOffset;
+			velocity1[lane] = constraint->_xVelocity;
+			offset2[lane] = constraint->_yOffset;
+			velocity2[lane] = constraint->_yVelocity;
+			ms[lane] = constraint->_massInverse * t;
+			es[lane] = constraint->_strength;
+			ws[lane] = constraint->_wind * f;
+			gs[lane] = constraint->_gravity * f * yDown;
+			ds[lane] = constraint->getDampingFactor(t);
+			ts[lane] = t;
+		}
+	}
+
+	// Simulate the steps all lanes of 4 have in common, for both axes. Values of an axis which isn't used are discarded.
+	for (size_t lane = 0; lane < laneCount; lane += 4) {
+		size_t n = laneCount - lane < 4 ? laneCount - lane : 4;
+		int common = steps[lanes[lane]];
+		for (size_t ii = 1; ii < n; ii++)
+			common = MathUtil::min(common, steps[lanes[lane + ii]]);
+		for (size_t ii = 0; ii < n; ii++)
+			done[lane + ii] = common;
+		Float4 xOffset = Simd::load(offset1 + lane), xVelocity = Simd::load(velocity1 + lane);
+		Float4 yOffset = Simd::load(offset2 + lane), yVelocity = Simd::load(velocity2 + lane);
+		Float4 m = Simd::load(ms + lane), e = Simd::load(es + lane), w = Simd::load(ws + lane);
+		Float4 g = Simd::load(gs + lane), d = Simd::load(ds + lane), t = Simd::load(ts + lane);
+		for (int step = 0; step < common; step++) {
+			xVelocity = Simd::add(xVelocity, Simd::mul(Simd::sub(w, Simd::mul(xOffset, e)), m));
+			xOffset = Simd::add(xOffset, Simd::mul(xVelocity, t));
+			xVelocity = Simd::mul(xVelocity, d);
+			yVelocity = Simd::sub(yVelocity, Simd::mul(Simd::add(g, Simd::mul(yOffset, e)), m));
+			yOffset = Simd::add(yOffset, Simd::mul(yVelocity, t));
+			yVelocity = Simd::mul(yVelocity, d);
+		}
+		Simd::store(offset1 + lane, xOffset);
+		Simd::store(velocity1 + lane, xVelocity);
+		Simd::store(offset2 + lane, yOffset);
+		Simd::store(velocity2 + lane, yVelocity);
+	}
+
+	// Scatter the translation and simulate any remaining steps one constraint at a time.
+	for (size_t lane = 0; lane < laneCount; lane++) {
+		PhysicsConstraint *constraint = (PhysicsConstraint *) cache[lanes[lane]];
+		if (constraint->_data._x > 0) {
+			constraint->_xOffset = offset1[lane];
+			constraint->_xVelocity = velocity1[lane];
+		}
+		if (constraint->_data._y > 0) {
+			constraint->_yOffset = offset2[lane];
+			constraint->_yVelocity = velocity2[lane];
+		}
+		constraint->stepTranslation(steps[lanes[lane]] - done[lane]);
+	}
+
+	// Apply the translation and gather the constraints which simulate rotation or scale steps.
+	laneCount = 0;
+	for (size_t i = 0; i < count; i++) {
+		if (steps[i] < 0) continue;
+		PhysicsConstraint *constraint = (PhysicsConstraint *) cache[i];
+		PhysicsConstraintData &data = constraint->_data;
+		Bone *bone = constraint->_bone;
+		float mix = constraint->_mix;
+		if (data._x > 0) bone->_worldX += constraint->_xOffset * mix * data._x;
+		if (data._y > 0) bone->_worldY += constraint->_yOffset * mix * data._y;
+		bool rotateOrShearX = data._rotate > 0 || data._shearX > 0;
+		if (!rotateOrShearX && data._scaleX <= 0) continue;
+		float ca, c, s, mr;
+		constraint->beginRotation(qx[i], qy[i], ca, c, s, mr);
+		if (steps[i] == 0) continue;
+		size_t lane = laneCount++;
+		float t = data._step;
+		lanes[lane] = (int) i;
+		rotates[lane] = rotateOrShearX ? 1 : 0;
+		offset1[lane] = constraint->_scaleOffset;
+		velocity1[lane] = constraint->_scaleVelocity;
+		offset2[lane] = constraint->_rotateOffset;
+		velocity2[lane] = constraint->_rotateVelocity;
+		cosines[lane] = c;
+		sines[lane] = s;
+		mixes[lane] = mr;
+		angles[lane] = ca;
+		ms[lane] = constraint->_massInverse * t;
+		es[lane] = constraint->_strength;
+		ws[lane] = constraint->_wind;
+		gs[lane] = constraint->_gravity * yDown;
+		hs[lane] = bone->_data.getLength() / f;
+		ds[lane] = constraint->getDampingFactor(t);
+		ts[lane] = t;
+	}
+
+	// Simulate the rotation and scale steps in common. The cosine and sine of each rotation are computed one lane at a
+	// time, so they are the same as when updating the constraints one at a time.
+	for (size_t lane = 0; lane < laneCount; lane += 4) {
+		size_t n = laneCount - lane < 4 ? laneCount - lane : 4;
+		int common = steps[lanes[lane]];
+		for (size_t ii = 1; ii < n; ii++)
+			common = MathUtil::min(common, steps[lanes[lane + ii]]);
+		for (size_t ii = 0; ii < n; ii++)
+			done[lane + ii] = common;
+		Float4 scaleOffset = Simd::load(offset1 + lane), scaleVelocity = Simd::load(velocity1 + lane);
+		Float4 rotateOffset = Simd::load(offset2 + lane), rotateVelocity = Simd::load(velocity2 + lane);
+		Float4 m = Simd::load(ms + lane), e = Simd::load(es + lane), w = Simd::load(ws + lane);
+		Float4 g = Simd::load(gs + lane), h = Simd::load(hs + lane), d = Simd::load(ds + lane), t = Simd::load(ts + lane);
+		for (int step = 0; step < common; step++) {
+			Float4 c = Simd::load(cosines + lane), s = Simd::load(sines + lane);
+			scaleVelocity = Simd::add(scaleVelocity,
+									  Simd::mul(Simd::sub(Simd::sub(Simd::mul(w, c), Simd::mul(g, s)), Simd::mul(scaleOffset, e)), m));
+			scaleOffset = Simd::add(scaleOffset, Simd::mul(scaleVelocity, t));
+			scaleVelocity = Simd::mul(scaleVelocity, d);
+			rotateVelocity = Simd::sub(rotateVelocity,
+									   Simd::mul(Simd::add(Simd::mul(Simd::add(Simd::mul(w, s), Simd::mul(g, c)), h), Simd::mul(rotateOffset, e)), m));
+			rotateOffset = Simd::add(rotateOffset, Simd::mul(rotateVelocity, t));
+			rotateVelocity = Simd::mul(rotateVelocity, d);
+			Simd::store(offset2 + lane, rotateOffset);
+			for (size_t ii = lane, nn = lane + n; ii < nn; ii++) {
+				if (!rotates[ii] || step + 1 >= steps[lanes[ii]]) continue;
+				float r = offset2[ii] * mixes[ii] + angles[ii];
+				cosines[ii] = MathUtil::cos(r);
+				sines[ii] = MathUtil::sin(r);
+			}
+		}
+		Simd::store(offset1 + lane, scaleOffset);
+		Simd::store(velocity1 + lane, scaleVelocity);
+		Simd::store(offset2 + lane, rotateOffset);
+		Simd::store(velocity2 + lane, rotateVelocity);
+	}
+
+	// Scatter the rotation and scale and simulate any remaining steps one constraint at a time.
+	for (size_t lane = 0; lane < laneCount; lane++) {
+		PhysicsConstraint *constraint = (PhysicsConstraint *) cache[lanes[lane]];
+		if (constraint->_data._scaleX > 0) {
+			constraint->_scaleOffset = offset1[lane];
+			constraint->_scaleVelocity = velocity1[lane];
+		}
+		if (rotates[lane]) {
+			constraint->_rotateOffset = offset2[lane];
+			constraint->_rotateVelocity = velocity2[lane];
+		}
+		int total = steps[lanes[lane]];
+		constraint->stepRotation(done[lane], total, total, angles[lane], cosines[lane], sines[lane], mixes[lane]);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (steps[i] == -2) continue;
+		PhysicsConstraint *constraint = (PhysicsConstraint *) cache[i];
+		constraint->_cx = constraint->_bone->_worldX;
+		constraint->_cy = constraint->_bone->_worldY;
+		constraint->endUpdate(physics);
 	}
 }
 
 void Skeleton::updateWorldTransform(Physics physics, Bone *parent) {
+	if (_dormant) return;
+	if (_wakePhysics != Physics_None && physics != Physics_None) {
+		physics = _wakePhysics;
+		_wakePhysics = Physics_None;
+	}
+	_physicsSteps = 0;
+	_physicsStepOverflows = 0;
+
 	// Apply the parent bone transform to the root bone. The root bone always
 	// inherits scale, rotation and reflection.
 	Bone *rootBone = getRootBone();
@@ -319,11 +802,13 @@ void Skeleton::setSlotsToSetupPose() {
 }
 
 Bone *Skeleton::findBone(const String &boneName) {
-	return ContainerUtil::findWithDataName(_bones, boneName);
+	BoneData *data = _data->findBone(boneName);
+	return data ? _bones[data->getIndex()] : NULL;
 }
 
 Slot *Skeleton::findSlot(const String &slotName) {
-	return ContainerUtil::findWithDataName(_slots, slotName);
+	SlotData *data = _data->findSlot(slotName);
+	return data ? _slots[data->getIndex()] : NULL;
 }
 
 void Skeleton::setSkin(const String &skinName) {
@@ -367,6 +852,9 @@ Attachment *Skeleton::getAttachment(int slotIndex,
 	if (attachmentName.isEmpty())
 		return NULL;
 
+	int attachmentHandle = _data->findAttachmentHandle(slotIndex, attachmentName);
+	if (attachmentHandle >= 0) return getAttachmentByHandle(slotIndex, attachmentHandle);
+
 	if (_skin != NULL) {
 		Attachment *attachment = _skin->getAttachment(slotIndex, attachmentName);
 		if (attachment != NULL) {
@@ -379,29 +867,40 @@ Attachment *Skeleton::getAttachment(int slotIndex,
 				   : NULL;
 }
 
+Attachment *Skeleton::getAttachmentByHandle(int slotIndex, int attachmentHandle) {
+	if (_skin != NULL) {
+		Attachment *attachment = _skin->getAttachment(slotIndex, *_data, attachmentHandle);
+		if (attachment != NULL) {
+			return attachment;
+		}
+	}
+
+	return _data->getDefaultSkin() != NULL
+				   ? _data->getDefaultSkin()->getAttachment(slotIndex, *_data, attachmentHandle)
+				   : NULL;
+}
+
 void Skeleton::setAttachment(const String &slotName,
 							 const String &attachmentName) {
 	assert(slotName.length() > 0);
 
-	for (size_t i = 0, n = _slots.size(); i < n; ++i) {
-		Slot *slot = _slots[i];
-		if (slot->_data.getName() == slotName) {
-			Attachment *attachment = NULL;
-			if (attachmentName.length() > 0) {
-				attachment = getAttachment((int) i, attachmentName);
+	SlotData *slotData = _data->findSlot(slotName);
+	if (slotData == NULL) {
+		printf("Slot not found: %s", slotName.buffer());
 
-				assert(attachment != NULL);
-			}
+		assert(false);
+		return;
+	}
 
-			slot->setAttachment(attachment);
+	int slotIndex = slotData->getIndex();
+	Attachment *attachment = NULL;
+	if (attachmentName.length() > 0) {
+		attachment = getAttachment(slotIndex, attachmentName);
 
-			return;
-		}
+		assert(attachment != NULL);
 	}
 
-	printf("Slot not found: %s", slotName.buffer());
-
-	assert(false);
+	_slots[slotIndex]->setAttachment(attachment);
 }
 
 IkConstraint *Skeleton::findIkConstraint(const String &constraintName) {
@@ -536,6 +1035,38 @@ void Skeleton::getBounds(float &outX, float &outY, float &outWidth,
 	outHeight = maxY - minY;
 }
 
+void Skeleton::getConservativeBounds(float &outX, float &outY, float &outWidth, float &outHeight) {
+	float minX = FLT_MAX;
+	float minY = FLT_MAX;
+	float maxX = -FLT_MAX;
+	float maxY = -FLT_MAX;
+
+	for (size_t i = 0; i < _slots.size(); ++i) {
+		Slot *slot = _slots[i];
+		if (!slot->_bone._active) continue;
+		Attachment *attachment = slot->getAttachment();
+		if (attachment == NULL) continue;
+
+		if (attachment->getRTTI().instanceOf(RegionAttachment::rtti)) {
+			float vertices[8];
+			static_cast<RegionAttachment *>(attachment)->computeWorldVertices(*slot, vertices, 0);
+			for (int ii = 0; ii < 8; ii += 2) {
+				minX = MathUtil::min(minX, vertices[ii]);
+				minY = MathUtil::min(minY, vertices[ii + 1]);
+				maxX = MathUtil::max(maxX, vertices[ii]);
+				maxY = MathUtil::max(maxY, vertices[ii + 1]);
+			}
+		} else if (attachment->getRTTI().instanceOf(MeshAttachment::rtti)) {
+			static_cast<MeshAttachment *>(attachment)->computeBounds(*slot, minX, minY, maxX, maxY);
+		}
+	}
+
+	outX = minX;
+	outY = minY;
+	outWidth = maxX - minX;
+	outHeight = maxY - minY;
+}
+
 Bone *Skeleton::getRootBone() { return _bones.size() == 0 ? NULL : _bones[0]; }
 
 SkeletonData *Skeleton::getData() { return _data; }
@@ -78,17 +78,21 @@ using namespace spine;
 
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
 															new (__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)),
-													_error(), _scale(1), _ownsLoader(true) {
+													_error(), _scale(1), _ownsLoader(true), _lazyAnimations(false) {
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader, bool ownsLoader) : _attachmentLoader(
 																							  attachmentLoader),
 																					  _error(),
 																					  _scale(1),
-																					  _ownsLoader(ownsLoader) {
+																					  _ownsLoader(ownsLoader),
+																					  _lazyAnimations(false) {
 	assert(_attachmentLoader != NULL);
 }
 
+SkeletonBinary::SkeletonBinary(float scale) : _attachmentLoader(NULL), _error(), _scale(scale), _ownsLoader(false), _lazyAnimations(false) {
+}
+
 SkeletonBinary::~SkeletonBinary() {
 	ContainerUtil::cleanUpVectorOfPointers(_linkedMeshes);
 	_linkedMeshes.clear();
@@ -384,8 +388,16 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	/* Animations. */
 	int animationsCount = readVarint(input, true);
 	skeletonData->_animations.setSize(animationsCount, 0);
+	if (_lazyAnimations) {
+		skeletonData->_animationData = input->cursor;
+		skeletonData->_animationDataEnd = input->end;
+		skeletonData->_animationOffsets.setSize(animationsCount, 0);
+		skeletonData->_animationsDecoded.setSize(animationsCount, false);
+		skeletonData->_animationScale = _scale;
+	}
 	for (int i = 0; i < animationsCount; ++i) {
 		String name(readString(input), true);
+		int offset = (int) (input->cursor - skeletonData->_animationData);
 		Animation *animation = readAnimation(name, input, skeletonData);
 		if (!animation) {
 			delete input;
@@ -393,22 +405,31 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 			return NULL;
 		}
 		skeletonData->_animations[i] = animation;
+		// Each animation is read once to find where the next one starts, then only its offset and duration are kept.
+		if (_lazyAnimations) skeletonData->setEncoded(animation, i, offset);
 	}
 
 	delete input;
+	skeletonData->buildNameIndex();
+	skeletonData->bindAttachmentHandles();
 	return skeletonData;
 }
 
 SkeletonData *SkeletonBinary::readSkeletonDataFile(const String &path) {
-	int length;
+	int length = 0;
 	SkeletonData *skeletonData;
-	const char *binary = SpineExtension::readFile(path.buffer(), &length);
+	const char *binary = SpineExtension::mapFile(path.buffer(), &length);
 	if (length == 0 || !binary) {
 		setError("Unable to read skeleton file: ", path.buffer());
 		return NULL;
 	}
 	skeletonData = readSkeletonData((unsigned char *) binary, length);
-	SpineExtension::free(binary, __FILE__, __LINE__);
+	if (skeletonData && _lazyAnimations) {
+		// Lazy animations are decoded from the mapping, which the skeleton data unmaps.
+		skeletonData->_mappedFile = binary;
+		skeletonData->_mappedFileLength = length;
+	} else
+		SpineExtension::unmapFile(binary, length);
 	return skeletonData;
 }
 
@@ -459,14 +480,10 @@ bool SkeletonBinary::readBoolean(DataInput *input) {
 }
 
 int SkeletonBinary::readInt(DataInput *input) {
-	int result = readByte(input);
-	result <<= 8;
-	result |= readByte(input);
-	result <<= 8;
-	result |= readByte(input);
-	result <<= 8;
-	result |= readByte(input);
-	return result;
+	// Assembled from a single 4 byte read so compilers emit one load and a byte swap.
+	const unsigned char *bytes = input->cursor;
+	input->cursor += 4;
+	return (int) (((unsigned int) bytes[0] << 24) | ((unsigned int) bytes[1] << 16) | ((unsigned int) bytes[2] << 8) | (unsigned int) bytes[3]);
 }
 
 void SkeletonBinary::readColor(DataInput *input, Color &color) {
@@ -651,6 +668,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			mesh->_bones.addAll(bones);
 			mesh->_vertices.addAll(vertices);
 			mesh->setWorldVerticesLength(verticesLength);
+			mesh->packWeights();
 			mesh->_triangles.addAll(triangles);
 			mesh->_regionUVs.addAll(uvs);
 			if (sequence == NULL) mesh->updateRegion();
@@ -1488,3 +1506,4 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 	}
 	return new (__FILE__, __LINE__) Animation(String(name), timelines, duration);
 }
+
@@ -30,17 +30,55 @@
 #include <spine/SkeletonClipping.h>
 
 #include <spine/ClippingAttachment.h>
+#include <spine/Bone.h>
+#include <spine/ContainerUtil.h>
+#include <spine/MathUtil.h>
+#include <spine/Simd.h>
 #include <spine/Slot.h>
 
+#include <string.h>
+
 using namespace spine;
 
-SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
+// The maximum number of clipping attachments whose decomposition is kept.
+static const size_t MAX_CACHES = 16;
+
+namespace spine {
+	/// The convex decomposition of an unweighted clipping attachment's polygon, made in bone space. polygons holds the
+	/// world vertices of each convex polygon, filled through indices which are offsets into the attachment's vertices.
+	class ClippingCache : public SpineObject {
+	public:
+		ClippingAttachment *attachment;
+		Vector<float> vertices;
+		Vector<float> deform;
+		Vector<Vector<float> *> polygons;
+		Vector<Vector<int> *> indices;
+
+		ClippingCache() : attachment(NULL) {
+		}
+
+		~ClippingCache() {
+			ContainerUtil::cleanUpVectorOfPointers(polygons);
+			ContainerUtil::cleanUpVectorOfPointers(indices);
+		}
+	};
+}
+
+static bool equals(Vector<float> &a, Vector<float> &b) {
+	return a.size() == b.size() && (a.size() == 0 || memcmp(a.buffer(), b.buffer(), a.size() * sizeof(float)) == 0);
+}
+
+SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL), _clippingPolygons(NULL) {
 	_clipOutput.ensureCapacity(128);
 	_clippedVertices.ensureCapacity(128);
 	_clippedTriangles.ensureCapacity(128);
 	_clippedUVs.ensureCapacity(128);
 }
 
+SkeletonClipping::~SkeletonClipping() {
+	ContainerUtil::cleanUpVectorOfPointers(_caches);
+}
+
 size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	if (_clipAttachment != NULL) {
 		return 0;
@@ -51,8 +89,26 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	int n = (int) clip->getWorldVerticesLength();
 	_clippingPolygon.setSize(n, 0);
 	clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
-	makeClockwise(_clippingPolygon);
-	_clippingPolygons = &_triangulator.decompose(_clippingPolygon, _triangulator.triangulate(_clippingPolygon));
+
+	ClippingCache *cache = getCache(slot, clip);
+	if (cache) {
+		// An invertible transform maps the bone space decomposition to a decomposition of the world polygon. If it
+		// mirrors the polygon, the winding of each convex polygon is flipped below.
+		float *vertices = _clippingPolygon.buffer();
+		for (size_t i = 0; i < cache->polygons.size(); ++i) {
+			Vector<float> &polygon = *cache->polygons[i];
+			Vector<int> &indices = *cache->indices[i];
+			polygon.clear();
+			for (size_t ii = 0; ii < indices.size(); ++ii) {
+				polygon.add(vertices[indices[ii]]);
+				polygon.add(vertices[indices[ii] + 1]);
+			}
+		}
+		_clippingPolygons = &cache->polygons;
+	} else {
+		makeClockwise(_clippingPolygon);
+		_clippingPolygons = &_triangulator.decompose(_clippingPolygon, _triangulator.triangulate(_clippingPolygon));
+	}
 
 	for (size_t i = 0; i < _clippingPolygons->size(); ++i) {
 		Vector<float> *polygonP = (*_clippingPolygons)[i];
@@ -62,9 +118,54 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 		polygon.add(polygon[1]);
 	}
 
+	computePolygonEdges();
 	return (*_clippingPolygons).size();
 }
 
+ClippingCache *SkeletonClipping::getCache(Slot &slot, ClippingAttachment *clip) {
+	if (clip->getBones().size() > 0) return NULL;
+	// A degenerate transform collapses the polygon, which is then decomposed in world space every time.
+	Bone &bone = slot.getBone();
+	if (MathUtil::abs(bone.getA() * bone.getD() - bone.getB() * bone.getC()) < 0.000001f) return NULL;
+
+	Vector<float> &deform = slot.getDeform();
+	for (size_t i = 0; i < _caches.size(); ++i) {
+		ClippingCache *cache = _caches[i];
+		if (cache->attachment != clip) continue;
+		if (equals(cache->vertices, clip->getVertices()) && equals(cache->deform, deform)) return cache;
+		delete cache;
+		_caches.removeAt(i);
+		break;
+	}
+
+	Vector<float> &polygon = _scratch;
+	polygon.clearAndAddAll(deform.size() > 0 ? deform : clip->getVertices());
+	bool reversed = makeClockwise(polygon);
+	_triangulator.decompose(polygon, _triangulator.triangulate(polygon));
+
+	if (_caches.size() == MAX_CACHES) {
+		delete _caches[0];
+		_caches.removeAt(0);
+	}
+	ClippingCache *cache = new (__FILE__, __LINE__) ClippingCache();
+	cache->attachment = clip;
+	cache->vertices.clearAndAddAll(clip->getVertices());
+	cache->deform.clearAndAddAll(deform);
+	// The indices are offsets into the clockwise polygon, so they are mapped back to the attachment's vertex order.
+	int last = (int) polygon.size() - 2;
+	Vector<Vector<int> *> &indices = _triangulator._convexPolygonsIndices;
+	for (size_t i = 0; i < indices.size(); ++i) {
+		Vector<int> &polygonIndices = *indices[i];
+		Vector<int> *cacheIndices = new (__FILE__, __LINE__) Vector<int>();
+		for (size_t ii = 0; ii < polygonIndices.size(); ++ii)
+			cacheIndices->add(reversed ? last - polygonIndices[ii] : polygonIndices[ii]);
+		cache->indices.add(cacheIndices);
+		cache->polygons.add(new (__FILE__, __LINE__) Vector<float>());
+	}
+	_caches.add(cache);
+	return cache;
+}
+
 void SkeletonClipping::clipEnd(Slot &slot) {
 	if (_clipAttachment != NULL && _clipAttachment->_endSlot == &slot._data) {
 		clipEnd();
@@ -109,8 +210,10 @@ continue_outer:
 		float x3 = vertices[vertexOffset], y3 = vertices[vertexOffset + 1];
 
 		for (size_t p = 0; p < polygonsCount; p++) {
+			int classification = classify(p, x1, y1, x2, y2, x3, y3);
+			if (classification < 0) continue;
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			if (classification == 0 && clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 
@@ -189,8 +292,10 @@ continue_outer:
 		float u3 = uvs[vertexOffset], v3 = uvs[vertexOffset + 1];
 
 		for (size_t p = 0; p < polygonsCount; p++) {
+			int classification = classify(p, x1, y1, x2, y2, x3, y3);
+			if (classification < 0) continue;
 			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
+			if (classification == 0 && clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
 				size_t clipOutputLength = clipOutput.size();
 				if (clipOutputLength == 0) continue;
 				float d0 = y2 - y3, d1 = x3 - x2, d2 = x1 - x3, d4 = y3 - y1;
@@ -252,6 +357,74 @@ continue_outer:
 	}
 }
 
+void SkeletonClipping::computePolygonEdges() {
+	Vector<Vector<float> *> &polygons = *_clippingPolygons;
+	_polygonBounds.setSize(polygons.size() * 4, 0);
+	_polygonEdges.clear();
+	_polygonEdgeOffsets.setSize(polygons.size() + 1, 0);
+	for (size_t p = 0; p < polygons.size(); p++) {
+		Vector<float> &polygon = *polygons[p];
+		float minX = polygon[0], minY = polygon[1], maxX = minX, maxY = minY;
+		for (size_t i = 2, n = polygon.size() - 2; i < n; i += 2) {
+			float x = polygon[i], y = polygon[i + 1];
+			if (x < minX) minX = x;
+			if (y < minY) minY = y;
+			if (x > maxX) maxX = x;
+			if (y > maxY) maxY = y;
+		}
+		float *bounds = _polygonBounds.buffer() + p * 4;
+		bounds[0] = minX;
+		bounds[1] = minY;
+		bounds[2] = maxX;
+		bounds[3] = maxY;
+
+		// Each block has 4 edges as edgeX, edgeY, ex and ey lanes, like in clip(). The last block repeats the last edge.
+		size_t edges = (polygon.size() >> 1) - 1, blocks = (edges + 3) >> 2;
+		size_t offset = _polygonEdges.size();
+		_polygonEdgeOffsets[p] = (int) offset;
+		_polygonEdges.setSize(offset + blocks * 16, 0);
+		float *block = _polygonEdges.buffer() + offset;
+		for (size_t e = 0; e < blocks * 4; e++) {
+			size_t i = (e < edges ? e : edges - 1) << 1;
+			float *lane = block + (e >> 2) * 16 + (e & 3);
+			lane[0] = polygon[i];
+			lane[4] = polygon[i + 1];
+			lane[8] = polygon[i] - polygon[i + 2];
+			lane[12] = polygon[i + 1] - polygon[i + 3];
+		}
+	}
+	_polygonEdgeOffsets[polygons.size()] = (int) _polygonEdges.size();
+}
+
+int SkeletonClipping::classify(size_t polygon, float x1, float y1, float x2, float y2, float x3, float y3) {
+	float *bounds = _polygonBounds.buffer() + polygon * 4;
+	float minX = x1 < x2 ? x1 : x2, minY = y1 < y2 ? y1 : y2, maxX = x1 > x2 ? x1 : x2, maxY = y1 > y2 ? y1 : y2;
+	if (x3 < minX) minX = x3;
+	if (y3 < minY) minY = y3;
+	if (x3 > maxX) maxX = x3;
+	if (y3 > maxY) maxY = y3;
+	if (maxX < bounds[0] || maxY < bounds[1] || minX > bounds[2] || minY > bounds[3]) return -1;
+
+	// Inside if every vertex is on the inner side of every edge, using the same arithmetic as clip().
+	Float4 zero = Simd::zero();
+	Float4 px1 = Simd::splat(x1), py1 = Simd::splat(y1);
+	Float4 px2 = Simd::splat(x2), py2 = Simd::splat(y2);
+	Float4 px3 = Simd::splat(x3), py3 = Simd::splat(y3);
+	const float *block = _polygonEdges.buffer() + _polygonEdgeOffsets[polygon];
+	const float *end = _polygonEdges.buffer() + _polygonEdgeOffsets[polygon + 1];
+	for (; block < end; block += 16) {
+		Float4 edgeX = Simd::load(block), edgeY = Simd::load(block + 4);
+		Float4 ex = Simd::load(block + 8), ey = Simd::load(block + 12);
+		if (!Simd::allGreater(Simd::sub(Simd::mul(ey, Simd::sub(edgeX, px1)), Simd::mul(ex, Simd::sub(edgeY, py1))), zero))
+			return 0;
+		if (!Simd::allGreater(Simd::sub(Simd::mul(ey, Simd::sub(edgeX, px2)), Simd::mul(ex, Simd::sub(edgeY, py2))), zero))
+			return 0;
+		if (!Simd::allGreater(Simd::sub(Simd::mul(ey, Simd::sub(edgeX, px3)), Simd::mul(ex, Simd::sub(edgeY, py3))), zero))
+			return 0;
+	}
+	return 1;
+}
+
 bool SkeletonClipping::isClipping() {
 	return _clipAttachment != NULL;
 }
@@ -370,7 +543,7 @@ bool SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, fl
 	return clipped;
 }
 
-void SkeletonClipping::makeClockwise(Vector<float> &polygon) {
+bool SkeletonClipping::makeClockwise(Vector<float> &polygon) {
 	size_t verticeslength = polygon.size();
 
 	float area = polygon[verticeslength - 2] * polygon[1] - polygon[0] * polygon[verticeslength - 1];
@@ -384,7 +557,7 @@ void SkeletonClipping::makeClockwise(Vector<float> &polygon) {
 		area += p1x * p2y - p2x * p1y;
 	}
 
-	if (area < 0) return;
+	if (area < 0) return false;
 
 	for (size_t i = 0, lastX = verticeslength - 2, n = verticeslength >> 1; i < n; i += 2) {
 		float x = polygon[i], y = polygon[i + 1];
@@ -394,4 +567,5 @@ void SkeletonClipping::makeClockwise(Vector<float> &polygon) {
 		polygon[other] = x;
 		polygon[other + 1] = y;
 	}
+	return true;
 }
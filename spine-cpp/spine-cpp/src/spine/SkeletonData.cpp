@@ -30,12 +30,15 @@
 #include <spine/SkeletonData.h>
 
 #include <spine/Animation.h>
+#include <spine/AttachmentTimeline.h>
 #include <spine/BoneData.h>
 #include <spine/EventData.h>
 #include <spine/IkConstraintData.h>
 #include <spine/PathConstraintData.h>
 #include <spine/PhysicsConstraintData.h>
+#include <spine/SkeletonBinary.h>
 #include <spine/Skin.h>
+#include <spine/Timeline.h>
 #include <spine/SlotData.h>
 #include <spine/TransformConstraintData.h>
 
@@ -52,6 +55,13 @@ SkeletonData::SkeletonData() : _name(),
 							   _referenceScale(100),
 							   _version(),
 							   _hash(),
+							   _animationData(NULL),
+							   _animationDataEnd(NULL),
+							   _mappedFile(NULL),
+							   _mappedFileLength(0),
+							   _animationScale(1),
+							   _animationDecodeListener(NULL),
+							   _frozen(false),
 							   _fps(0),
 							   _imagesPath() {
 }
@@ -72,42 +82,241 @@ SkeletonData::~SkeletonData() {
 	for (size_t i = 0; i < _strings.size(); i++) {
 		SpineExtension::free(_strings[i], __FILE__, __LINE__);
 	}
+	releaseAnimationData();
 }
 
 BoneData *SkeletonData::findBone(const String &boneName) {
-	return ContainerUtil::findWithName(_bones, boneName);
+	return _boneIndex.find(_bones, boneName);
 }
 
 SlotData *SkeletonData::findSlot(const String &slotName) {
-	return ContainerUtil::findWithName(_slots, slotName);
+	return _slotIndex.find(_slots, slotName);
 }
 
 Skin *SkeletonData::findSkin(const String &skinName) {
-	return ContainerUtil::findWithName(_skins, skinName);
+	return _skinIndex.find(_skins, skinName);
 }
 
 spine::EventData *SkeletonData::findEvent(const String &eventDataName) {
-	return ContainerUtil::findWithName(_events, eventDataName);
+	return _eventIndex.find(_events, eventDataName);
 }
 
 Animation *SkeletonData::findAnimation(const String &animationName) {
-	return ContainerUtil::findWithName(_animations, animationName);
+	Animation *animation = _animationIndex.find(_animations, animationName);
+	if (animation) decodeAnimation(animation);
+	return animation;
+}
+
+void SkeletonData::buildNameIndex() {
+	_boneIndex.build(_bones);
+	_slotIndex.build(_slots);
+	_skinIndex.build(_skins);
+	_eventIndex.build(_events);
+	_animationIndex.build(_animations);
+	_ikConstraintIndex.build(_ikConstraints);
+	_transformConstraintIndex.build(_transformConstraints);
+	_pathConstraintIndex.build(_pathConstraints);
+	_physicsConstraintIndex.build(_physicsConstraints);
+}
+
+bool SkeletonData::decodeAnimation(Animation *animation) {
+	if (_frozen || !_animationData) return true;
+	int index = animation->_index;
+	if (index < 0 || index >= (int) _animations.size() || _animations[index] != animation || _animationsDecoded[index])
+		return true;
+
+	SkeletonBinary binary(_animationScale);
+	SkeletonBinary::DataInput input;
+	input.cursor = _animationData + _animationOffsets[index];
+	input.end = _animationDataEnd;
+	Animation *decoded = binary.readAnimation(animation->getName(), &input, this);
+	if (!decoded) return false;
+	animation->setTimelines(decoded->_timelines);
+	animation->_duration = decoded->_duration;
+	decoded->_timelines.clear();
+	delete decoded;
+	bindAttachmentHandles(animation);
+	bindPropertySlots(animation);
+	_animationsDecoded[index] = true;
+	if (_animationDecodeListener) _animationDecodeListener->decoded(*this, *animation);
+	return true;
+}
+
+void SkeletonData::evictAnimation(Animation *animation) {
+	if (_frozen || !_animationData) return;
+	int index = animation->_index;
+	if (index < 0 || index >= (int) _animations.size() || _animations[index] != animation || !_animationsDecoded[index])
+		return;
+	deleteTimelines(animation);
+	_animationsDecoded[index] = false;
+}
+
+void SkeletonData::setAnimationDecodeListener(AnimationDecodeListener *listener) {
+	_animationDecodeListener = listener;
+}
+
+AnimationDecodeListener *SkeletonData::getAnimationDecodeListener() {
+	return _animationDecodeListener;
+}
+
+void SkeletonData::setEncoded(Animation *animation, int index, int offset) {
+	deleteTimelines(animation);
+	animation->_index = index;
+	_animationOffsets[index] = offset;
+}
+
+void SkeletonData::deleteTimelines(Animation *animation) {
+	ContainerUtil::cleanUpVectorOfPointers(animation->_timelines);
+	animation->_timelineIds.clear();
+	animation->_propertySlotBits.clear();
+	animation->_propertySlotsBound = false;
+}
+
+void SkeletonData::releaseAnimationData() {
+	if (_mappedFile) SpineExtension::unmapFile(_mappedFile, _mappedFileLength);
+	_mappedFile = NULL;
+	_mappedFileLength = 0;
+	_animationData = NULL;
+	_animationDataEnd = NULL;
+}
+
+bool SkeletonData::freeze() {
+	// Animations are decoded without the listener, which could evict them again.
+	_animationDecodeListener = NULL;
+	for (size_t i = 0; i < _animations.size(); i++) {
+		Animation *animation = _animations[i];
+		if (!decodeAnimation(animation)) return false;
+		if (!animation->_propertySlotsBound) bindPropertySlots(animation);
+		Vector<Timeline *> &timelines = animation->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			timelines[ii]->setSearchCache(false);
+			timelines[ii]->_frozen = true;
+		}
+	}
+	releaseAnimationData();
+	_animationOffsets.clear();
+	_animationsDecoded.clear();
+	_frozen = true;
+	return true;
+}
+
+bool SkeletonData::isFrozen() {
+	return _frozen;
+}
+
+int SkeletonData::findAttachmentHandle(size_t slotIndex, const String &attachmentName) {
+	if (slotIndex >= _attachmentHandleTables.size()) return -1;
+	Vector<int> &table = _attachmentHandleTables[slotIndex];
+	if (table.size() == 0) return -1;
+	Vector<String> &names = _attachmentHandleNames[slotIndex];
+	size_t mask = table.size() - 1;
+	for (size_t i = hashMapKey(attachmentName) & mask;; i = (i + 1) & mask) {
+		int handle = table[i];
+		if (handle < 0 || names[handle] == attachmentName) return handle;
+	}
+}
+
+static void addToHandleTable(Vector<int> &table, Vector<String> &names, int handle) {
+	size_t mask = table.size() - 1;
+	size_t i = hashMapKey(names[handle]) & mask;
+	while (table[i] >= 0) i = (i + 1) & mask;
+	table[i] = handle;
+}
+
+int SkeletonData::addAttachmentHandle(size_t slotIndex, const String &attachmentName) {
+	if (attachmentName.isEmpty()) return -1;
+	int handle = findAttachmentHandle(slotIndex, attachmentName);
+	if (handle >= 0 || _frozen) return handle;
+	if (slotIndex >= _attachmentHandleNames.size()) {
+		_attachmentHandleNames.setSize(slotIndex + 1, Vector<String>());
+		_attachmentHandleTables.setSize(slotIndex + 1, Vector<int>());
+	}
+	Vector<String> &names = _attachmentHandleNames[slotIndex];
+	Vector<int> &table = _attachmentHandleTables[slotIndex];
+	names.add(attachmentName);
+	handle = (int) names.size() - 1;
+	// The table is at most half full, it is rebuilt twice as large when it would be fuller.
+	if (names.size() * 2 > table.size()) {
+		size_t size = table.size() == 0 ? 8 : table.size() * 2;
+		table.clear();
+		table.setSize(size, -1);
+		for (int i = 0; i <= handle; i++)
+			addToHandleTable(table, names, i);
+	} else
+		addToHandleTable(table, names, handle);
+	return handle;
+}
+
+const String &SkeletonData::getAttachmentHandleName(size_t slotIndex, int attachmentHandle) {
+	return _attachmentHandleNames[slotIndex][attachmentHandle];
+}
+
+void SkeletonData::bindAttachmentHandles() {
+	for (size_t i = 0; i < _slots.size(); i++) {
+		SlotData *slot = _slots[i];
+		slot->_attachmentHandle = addAttachmentHandle(i, slot->_attachmentName);
+	}
+	for (size_t i = 0; i < _skins.size(); i++)
+		_skins[i]->bindAttachmentHandles(*this);
+	for (size_t i = 0; i < _animations.size(); i++) {
+		bindAttachmentHandles(_animations[i]);
+		bindPropertySlots(_animations[i]);
+	}
+}
+
+void SkeletonData::bindAttachmentHandles(Animation *animation) {
+	Vector<Timeline *> &timelines = animation->getTimelines();
+	for (size_t i = 0; i < timelines.size(); i++) {
+		if (timelines[i]->getRTTI().isExactly(AttachmentTimeline::rtti))
+			static_cast<AttachmentTimeline *>(timelines[i])->bindAttachmentHandles(*this);
+	}
+}
+
+int SkeletonData::getPropertySlotCount() {
+	return (int) _propertySlots.size();
+}
+
+int SkeletonData::addPropertySlot(PropertyId id) {
+	if (_propertySlots.containsKey(id)) return _propertySlots[id];
+	int slot = (int) _propertySlots.size();
+	_propertySlots.put(id, slot);
+	return slot;
+}
+
+void SkeletonData::bindPropertySlots(Animation *animation) {
+	if (_frozen) return;
+	Vector<Timeline *> &timelines = animation->getTimelines();
+	Vector<unsigned int> &bits = animation->_propertySlotBits;
+	bits.clear();
+	for (size_t i = 0; i < timelines.size(); i++) {
+		Vector<PropertyId> &ids = timelines[i]->getPropertyIds();
+		Vector<int> &slots = timelines[i]->_propertySlots;
+		slots.setSize(ids.size(), 0);
+		for (size_t ii = 0; ii < ids.size(); ii++) {
+			int slot = addPropertySlot(ids[ii]);
+			slots[ii] = slot;
+			size_t word = (size_t) slot >> 5;
+			if (word >= bits.size()) bits.setSize(word + 1, 0);
+			bits[word] |= 1u << (slot & 31);
+		}
+	}
+	animation->_propertySlotsBound = true;
 }
 
 IkConstraintData *SkeletonData::findIkConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_ikConstraints, constraintName);
+	return _ikConstraintIndex.find(_ikConstraints, constraintName);
 }
 
 TransformConstraintData *SkeletonData::findTransformConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_transformConstraints, constraintName);
+	return _transformConstraintIndex.find(_transformConstraints, constraintName);
 }
 
 PathConstraintData *SkeletonData::findPathConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_pathConstraints, constraintName);
+	return _pathConstraintIndex.find(_pathConstraints, constraintName);
 }
 
 PhysicsConstraintData *SkeletonData::findPhysicsConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_physicsConstraints, constraintName);
+	return _physicsConstraintIndex.find(_physicsConstraints, constraintName);
 }
 
 const String &SkeletonData::getName() {
@@ -132,16 +132,31 @@ SkeletonData *SkeletonJson::readSkeletonDataFile(const String &path) {
 	return skeletonData;
 }
 
+/// Enters the skins array or animations object of a document.
+static bool beginItems(JsonReader &reader, const char *position, bool object) {
+	reader.setPosition(position);
+	return object ? reader.beginObject() : reader.beginArray();
+}
+
+/// Parses the next skin or animation, which is deleted once it was read. Returns NULL after the last item or if the item
+/// is malformed, in which case the reader's position is NULL.
+static Json *readItem(JsonReader &reader) {
+	return reader.next() ? reader.readValue() : NULL;
+}
+
 SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 	int i, ii;
 	SkeletonData *skeletonData;
-	Json *root, *skeleton, *bones, *boneMap, *ik, *transform, *path, *physics, *slots, *skins, *animations, *events;
+	Json *root, *skeleton, *bones, *boneMap, *ik, *transform, *path, *physics, *slots, *events;
+	const char *skins = NULL, *animations = NULL;
 
 	_error = "";
 	_linkedMeshes.clear();
 
-	root = new (__FILE__, __LINE__) Json(json);
-
+	// Skins and animations are most of a document. They are parsed one item at a time once the other sections were
+	// read, so a Json tree for the whole document is never built.
+	JsonReader reader(json);
+	root = readSections(reader, skins, animations);
 	if (!root) {
 		setError(NULL, "Invalid skeleton JSON: ", Json::getError());
 		return NULL;
@@ -221,6 +236,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 		skeletonData->_bones[i] = data;
 		bonesCount++;
 	}
+	skeletonData->_boneIndex.build(skeletonData->_bones);
 
 	/* Slots. */
 	slots = Json::getItem(root, "slots");
@@ -279,6 +295,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			skeletonData->_slots[i] = data;
 		}
 	}
+	skeletonData->_slotIndex.build(skeletonData->_slots);
 
 	/* IK constraints. */
 	ik = Json::getItem(root, "ik");
@@ -500,285 +517,26 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 	}
 
 	/* Skins. */
-	skins = Json::getItem(root, "skins");
 	if (skins) {
 		Json *skinMap;
-		skeletonData->_skins.ensureCapacity(skins->_size);
-		skeletonData->_skins.setSize(skins->_size, 0);
-		int skinsIndex = 0;
-		for (skinMap = skins->_child, i = 0; skinMap; skinMap = skinMap->_next, ++i) {
-			Json *attachmentsMap;
-			Json *curves;
-
-			Skin *skin = new (__FILE__, __LINE__) Skin(Json::getString(skinMap, "name", ""));
-
-			Json *item = Json::getItem(skinMap, "bones");
-			if (item) {
-				for (item = item->_child; item; item = item->_next) {
-					BoneData *data = skeletonData->findBone(item->_valueString);
-					if (!data) {
-						delete skeletonData;
-						setError(root, String("Skin bone not found: "), item->_valueString);
-						return NULL;
-					}
-					skin->getBones().add(data);
-				}
-			}
-
-			item = Json::getItem(skinMap, "ik");
-			if (item) {
-				for (item = item->_child; item; item = item->_next) {
-					IkConstraintData *data = skeletonData->findIkConstraint(item->_valueString);
-					if (!data) {
-						delete skeletonData;
-						setError(root, String("Skin IK constraint not found: "), item->_valueString);
-						return NULL;
-					}
-					skin->getConstraints().add(data);
-				}
-			}
-
-			item = Json::getItem(skinMap, "transform");
-			if (item) {
-				for (item = item->_child; item; item = item->_next) {
-					TransformConstraintData *data = skeletonData->findTransformConstraint(item->_valueString);
-					if (!data) {
-						delete skeletonData;
-						setError(root, String("Skin transform constraint not found: "), item->_valueString);
-						return NULL;
-					}
-					skin->getConstraints().add(data);
-				}
-			}
-
-			item = Json::getItem(skinMap, "path");
-			if (item) {
-				for (item = item->_child; item; item = item->_next) {
-					PathConstraintData *data = skeletonData->findPathConstraint(item->_valueString);
-					if (!data) {
-						delete skeletonData;
-						setError(root, String("Skin path constraint not found: "), item->_valueString);
-						return NULL;
-					}
-					skin->getConstraints().add(data);
-				}
-			}
-
-			item = Json::getItem(skinMap, "physics");
-			if (item) {
-				for (item = item->_child; item; item = item->_next) {
-					PhysicsConstraintData *data = skeletonData->findPhysicsConstraint(item->_valueString);
-					if (!data) {
-						delete skeletonData;
-						setError(root, String("Skin physics constraint not found: "), item->_valueString);
-						return NULL;
-					}
-					skin->getConstraints().add(data);
-				}
-			}
-
-			skeletonData->_skins[skinsIndex++] = skin;
-			if (strcmp(Json::getString(skinMap, "name", ""), "default") == 0) {
-				skeletonData->_defaultSkin = skin;
+		if (!beginItems(reader, skins, false)) {
+			delete skeletonData;
+			setError(root, "Invalid skeleton JSON: ", Json::getError());
+			return NULL;
+		}
+		while ((skinMap = readItem(reader))) {
+			bool read = readSkin(skinMap, skeletonData);
+			delete skinMap;
+			if (!read) {
+				delete skeletonData;
+				delete root;
+				return NULL;
 			}
-
-			Json *attachments = Json::getItem(skinMap, "attachments");
-			if (attachments)
-				for (attachmentsMap = attachments->_child;
-					 attachmentsMap; attachmentsMap = attachmentsMap->_next) {
-					SlotData *slot = skeletonData->findSlot(attachmentsMap->_name);
-					Json *attachmentMap;
-
-					for (attachmentMap = attachmentsMap->_child; attachmentMap; attachmentMap = attachmentMap->_next) {
-						Attachment *attachment = NULL;
-						const char *skinAttachmentName = attachmentMap->_name;
-						const char *attachmentName = Json::getString(attachmentMap, "name", skinAttachmentName);
-						const char *attachmentPath = Json::getString(attachmentMap, "path", attachmentName);
-						const char *color;
-						Json *entry;
-
-						const char *typeString = Json::getString(attachmentMap, "type", "region");
-						AttachmentType type;
-						if (strcmp(typeString, "region") == 0) type = AttachmentType_Region;
-						else if (strcmp(typeString, "mesh") == 0)
-							type = AttachmentType_Mesh;
-						else if (strcmp(typeString, "linkedmesh") == 0)
-							type = AttachmentType_Linkedmesh;
-						else if (strcmp(typeString, "boundingbox") == 0)
-							type = AttachmentType_Boundingbox;
-						else if (strcmp(typeString, "path") == 0)
-							type = AttachmentType_Path;
-						else if (strcmp(typeString, "clipping") == 0)
-							type = AttachmentType_Clipping;
-						else if (strcmp(typeString, "point") == 0)
-							type = AttachmentType_Point;
-						else {
-							delete skeletonData;
-							setError(root, "Unknown attachment type: ", typeString);
-							return NULL;
-						}
-
-						switch (type) {
-							case AttachmentType_Region: {
-								Sequence *sequence = readSequence(Json::getItem(attachmentMap, "sequence"));
-								attachment = _attachmentLoader->newRegionAttachment(*skin, attachmentName, attachmentPath, sequence);
-								if (!attachment) {
-									delete skeletonData;
-									setError(root, "Error reading attachment: ", skinAttachmentName);
-									return NULL;
-								}
-
-								RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
-								region->_path = attachmentPath;
-
-								region->_x = Json::getFloat(attachmentMap, "x", 0) * _scale;
-								region->_y = Json::getFloat(attachmentMap, "y", 0) * _scale;
-								region->_scaleX = Json::getFloat(attachmentMap, "scaleX", 1);
-								region->_scaleY = Json::getFloat(attachmentMap, "scaleY", 1);
-								region->_rotation = Json::getFloat(attachmentMap, "rotation", 0);
-								region->_width = Json::getFloat(attachmentMap, "width", 32) * _scale;
-								region->_height = Json::getFloat(attachmentMap, "height", 32) * _scale;
-								region->_sequence = sequence;
-
-								color = Json::getString(attachmentMap, "color", 0);
-								if (color) toColor(region->getColor(), color, true);
-
-								if (region->_region != NULL) region->updateRegion();
-								_attachmentLoader->configureAttachment(region);
-								break;
-							}
-							case AttachmentType_Mesh:
-							case AttachmentType_Linkedmesh: {
-								Sequence *sequence = readSequence(Json::getItem(attachmentMap, "sequence"));
-								attachment = _attachmentLoader->newMeshAttachment(*skin, attachmentName, attachmentPath, sequence);
-
-								if (!attachment) {
-									delete skeletonData;
-									setError(root, "Error reading attachment: ", skinAttachmentName);
-									return NULL;
-								}
-
-								MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
-								mesh->_path = attachmentPath;
-
-								color = Json::getString(attachmentMap, "color", 0);
-								if (color) toColor(mesh->getColor(), color, true);
-
-								mesh->_width = Json::getFloat(attachmentMap, "width", 32) * _scale;
-								mesh->_height = Json::getFloat(attachmentMap, "height", 32) * _scale;
-								mesh->_sequence = sequence;
-
-								entry = Json::getItem(attachmentMap, "parent");
-								if (!entry) {
-									int verticesLength;
-									entry = Json::getItem(attachmentMap, "triangles");
-									mesh->_triangles.ensureCapacity(entry->_size);
-									mesh->_triangles.setSize(entry->_size, 0);
-									for (entry = entry->_child, ii = 0; entry; entry = entry->_next, ++ii)
-										mesh->_triangles[ii] = (unsigned short) entry->_valueInt;
-
-									entry = Json::getItem(attachmentMap, "uvs");
-									verticesLength = entry->_size;
-									mesh->_regionUVs.ensureCapacity(verticesLength);
-									mesh->_regionUVs.setSize(verticesLength, 0);
-									for (entry = entry->_child, ii = 0; entry; entry = entry->_next, ++ii)
-										mesh->_regionUVs[ii] = entry->_valueFloat;
-
-									readVertices(attachmentMap, mesh, verticesLength);
-
-									if (mesh->_region != NULL) mesh->updateRegion();
-
-									mesh->_hullLength = Json::getInt(attachmentMap, "hull", 0);
-
-									entry = Json::getItem(attachmentMap, "edges");
-									if (entry) {
-										mesh->_edges.ensureCapacity(entry->_size);
-										mesh->_edges.setSize(entry->_size, 0);
-										for (entry = entry->_child, ii = 0; entry; entry = entry->_next, ++ii)
-											mesh->_edges[ii] = entry->_valueInt;
-									}
-									_attachmentLoader->configureAttachment(mesh);
-								} else {
-									bool inheritTimelines = Json::getInt(attachmentMap, "timelines", 1) ? true : false;
-									LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh,
-																								 String(Json::getString(
-																										 attachmentMap,
-																										 "skin", 0)),
-																								 slot->getIndex(),
-																								 String(entry->_valueString),
-																								 inheritTimelines);
-									_linkedMeshes.add(linkedMesh);
-								}
-								break;
-							}
-							case AttachmentType_Boundingbox: {
-								attachment = _attachmentLoader->newBoundingBoxAttachment(*skin, attachmentName);
-
-								BoundingBoxAttachment *box = static_cast<BoundingBoxAttachment *>(attachment);
-
-								int vertexCount = Json::getInt(attachmentMap, "vertexCount", 0) << 1;
-								readVertices(attachmentMap, box, vertexCount);
-								color = Json::getString(attachmentMap, "color", NULL);
-								if (color) toColor(box->getColor(), color, true);
-								_attachmentLoader->configureAttachment(attachment);
-								break;
-							}
-							case AttachmentType_Path: {
-								attachment = _attachmentLoader->newPathAttachment(*skin, attachmentName);
-
-								PathAttachment *pathAttatchment = static_cast<PathAttachment *>(attachment);
-
-								int vertexCount = 0;
-								pathAttatchment->_closed = Json::getInt(attachmentMap, "closed", 0) ? true : false;
-								pathAttatchment->_constantSpeed = Json::getInt(attachmentMap, "constantSpeed", 1) ? true
-																												  : false;
-								vertexCount = Json::getInt(attachmentMap, "vertexCount", 0);
-								readVertices(attachmentMap, pathAttatchment, vertexCount << 1);
-
-								pathAttatchment->_lengths.ensureCapacity(vertexCount / 3);
-								pathAttatchment->_lengths.setSize(vertexCount / 3, 0);
-
-								curves = Json::getItem(attachmentMap, "lengths");
-								for (curves = curves->_child, ii = 0; curves; curves = curves->_next, ++ii)
-									pathAttatchment->_lengths[ii] = curves->_valueFloat * _scale;
-								color = Json::getString(attachmentMap, "color", NULL);
-								if (color) toColor(pathAttatchment->getColor(), color, true);
-								_attachmentLoader->configureAttachment(attachment);
-								break;
-							}
-							case AttachmentType_Point: {
-								attachment = _attachmentLoader->newPointAttachment(*skin, attachmentName);
-
-								PointAttachment *point = static_cast<PointAttachment *>(attachment);
-
-								point->_x = Json::getFloat(attachmentMap, "x", 0) * _scale;
-								point->_y = Json::getFloat(attachmentMap, "y", 0) * _scale;
-								point->_rotation = Json::getFloat(attachmentMap, "rotation", 0);
-								color = Json::getString(attachmentMap, "color", NULL);
-								if (color) toColor(point->getColor(), color, true);
-								_attachmentLoader->configureAttachment(attachment);
-								break;
-							}
-							case AttachmentType_Clipping: {
-								attachment = _attachmentLoader->newClippingAttachment(*skin, attachmentName);
-
-								ClippingAttachment *clip = static_cast<ClippingAttachment *>(attachment);
-
-								int vertexCount = 0;
-								const char *end = Json::getString(attachmentMap, "end", 0);
-								if (end) clip->_endSlot = skeletonData->findSlot(end);
-								vertexCount = Json::getInt(attachmentMap, "vertexCount", 0) << 1;
-								readVertices(attachmentMap, clip, vertexCount);
-								color = Json::getString(attachmentMap, "color", NULL);
-								if (color) toColor(clip->getColor(), color, true);
-								_attachmentLoader->configureAttachment(attachment);
-								break;
-							}
-						}
-
-						skin->setAttachment(slot->getIndex(), skinAttachmentName, attachment);
-					}
-				}
+		}
+		if (!reader.getPosition()) {
+			delete skeletonData;
+			setError(root, "Invalid skeleton JSON: ", Json::getError());
+			return NULL;
 		}
 	}
 
@@ -831,28 +589,337 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 	}
 
 	/* Animations. */
-	animations = Json::getItem(root, "animations");
 	if (animations) {
 		Json *animationMap;
-		skeletonData->_animations.ensureCapacity(animations->_size);
-		skeletonData->_animations.setSize(animations->_size, 0);
-		int animationsIndex = 0;
-		for (animationMap = animations->_child; animationMap; animationMap = animationMap->_next) {
+		if (!beginItems(reader, animations, true)) {
+			delete skeletonData;
+			setError(root, "Invalid skeleton JSON: ", Json::getError());
+			return NULL;
+		}
+		while ((animationMap = readItem(reader))) {
 			Animation *animation = readAnimation(animationMap, skeletonData);
+			delete animationMap;
 			if (!animation) {
 				delete skeletonData;
 				delete root;
 				return NULL;
 			}
-			skeletonData->_animations[animationsIndex++] = animation;
+			skeletonData->_animations.add(animation);
+		}
+		if (!reader.getPosition()) {
+			delete skeletonData;
+			setError(root, "Invalid skeleton JSON: ", Json::getError());
+			return NULL;
 		}
 	}
 
 	delete root;
 
+	skeletonData->buildNameIndex();
+	skeletonData->bindAttachmentHandles();
 	return skeletonData;
 }
 
+Json *SkeletonJson::readSections(JsonReader &reader, const char *&skins, const char *&animations) {
+	if (!reader.beginObject()) return NULL;
+	Json *root = new (__FILE__, __LINE__) Json(NULL);
+	root->_type = Json::JSON_OBJECT;
+	Json *last = NULL;
+	while (reader.next()) {
+		const char *name = reader.getName();
+		bool isSkins = !Json::json_strcasecmp(name, "skins"), isAnimations = !Json::json_strcasecmp(name, "animations");
+		if (isSkins || isAnimations) {
+			const char *&position = isSkins ? skins : animations;
+			if (!position) position = reader.getPosition();
+			reader.skipValue();
+			continue;
+		}
+		Json *section = reader.readValue();
+		if (!section) break;
+		if (last)
+			last->_next = section;
+		else
+			root->_child = section;
+		last = section;
+		root->_size++;
+	}
+	if (!reader.getPosition()) {
+		delete root;
+		return NULL;
+	}
+	return root;
+}
+
+bool SkeletonJson::readSkin(Json *skinMap, SkeletonData *skeletonData) {
+	int ii;
+	Json *attachmentsMap;
+	Json *curves;
+
+	Skin *skin = new (__FILE__, __LINE__) Skin(Json::getString(skinMap, "name", ""));
+	skeletonData->_skins.add(skin);
+
+	Json *item = Json::getItem(skinMap, "bones");
+	if (item) {
+		for (item = item->_child; item; item = item->_next) {
+			BoneData *data = skeletonData->findBone(item->_valueString);
+			if (!data) {
+				setError(NULL, String("Skin bone not found: "), item->_valueString);
+				return false;
+			}
+			skin->getBones().add(data);
+		}
+	}
+
+	item = Json::getItem(skinMap, "ik");
+	if (item) {
+		for (item = item->_child; item; item = item->_next) {
+			IkConstraintData *data = skeletonData->findIkConstraint(item->_valueString);
+			if (!data) {
+				setError(NULL, String("Skin IK constraint not found: "), item->_valueString);
+				return false;
+			}
+			skin->getConstraints().add(data);
+		}
+	}
+
+	item = Json::getItem(skinMap, "transform");
+	if (item) {
+		for (item = item->_child; item; item = item->_next) {
+			TransformConstraintData *data = skeletonData->findTransformConstraint(item->_valueString);
+			if (!data) {
+				setError(NULL, String("Skin transform constraint not found: "), item->_valueString);
+				return false;
+			}
+			skin->getConstraints().add(data);
+		}
+	}
+
+	item = Json::getItem(skinMap, "path");
+	if (item) {
+		for (item = item->_child; item; item = item->_next) {
+			PathConstraintData *data = skeletonData->findPathConstraint(item->_valueString);
+			if (!data) {
+				setError(NULL, String("Skin path constraint not found: "), item->_valueString);
+				return false;
+			}
+			skin->getConstraints().add(data);
+		}
+	}
+
+	item = Json::getItem(skinMap, "physics");
+	if (item) {
+		for (item = item->_child; item; item = item->_next) {
+			PhysicsConstraintData *data = skeletonData->findPhysicsConstraint(item->_valueString);
+			if (!data) {
+				setError(NULL, String("Skin physics constraint not found: "), item->_valueString);
+				return false;
+			}
+			skin->getConstraints().add(data);
+		}
+	}
+
+	if (strcmp(Json::getString(skinMap, "name", ""), "default") == 0) {
+		skeletonData->_defaultSkin = skin;
+	}
+
+	Json *attachments = Json::getItem(skinMap, "attachments");
+	if (attachments)
+		for (attachmentsMap = attachments->_child;
+			 attachmentsMap; attachmentsMap = attachmentsMap->_next) {
+			SlotData *slot = skeletonData->findSlot(attachmentsMap->_name);
+			Json *attachmentMap;
+
+			for (attachmentMap = attachmentsMap->_child; attachmentMap; attachmentMap = attachmentMap->_next) {
+				Attachment *attachment = NULL;
+				const char *skinAttachmentName = attachmentMap->_name;
+				const char *attachmentName = Json::getString(attachmentMap, "name", skinAttachmentName);
+				const char *attachmentPath = Json::getString(attachmentMap, "path", attachmentName);
+				const char *color;
+				Json *entry;
+
+				const char *typeString = Json::getString(attachmentMap, "type", "region");
+				AttachmentType type;
+				if (strcmp(typeString, "region") == 0) type = AttachmentType_Region;
+				else if (strcmp(typeString, "mesh") == 0)
+					type = AttachmentType_Mesh;
+				else if (strcmp(typeString, "linkedmesh") == 0)
+					type = AttachmentType_Linkedmesh;
+				else if (strcmp(typeString, "boundingbox") == 0)
+					type = AttachmentType_Boundingbox;
+				else if (strcmp(typeString, "path") == 0)
+					type = AttachmentType_Path;
+				else if (strcmp(typeString, "clipping") == 0)
+					type = AttachmentType_Clipping;
+				else if (strcmp(typeString, "point") == 0)
+					type = AttachmentType_Point;
+				else {
+					setError(NULL, "Unknown attachment type: ", typeString);
+					return false;
+				}
+
+				switch (type) {
+					case AttachmentType_Region: {
+						Sequence *sequence = readSequence(Json::getItem(attachmentMap, "sequence"));
+						attachment = _attachmentLoader->newRegionAttachment(*skin, attachmentName, attachmentPath, sequence);
+						if (!attachment) {
+							setError(NULL, "Error reading attachment: ", skinAttachmentName);
+							return false;
+						}
+
+						RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+						region->_path = attachmentPath;
+
+						region->_x = Json::getFloat(attachmentMap, "x", 0) * _scale;
+						region->_y = Json::getFloat(attachmentMap, "y", 0) * _scale;
+						region->_scaleX = Json::getFloat(attachmentMap, "scaleX", 1);
+						region->_scaleY = Json::getFloat(attachmentMap, "scaleY", 1);
+						region->_rotation = Json::getFloat(attachmentMap, "rotation", 0);
+						region->_width = Json::getFloat(attachmentMap, "width", 32) * _scale;
+						region->_height = Json::getFloat(attachmentMap, "height", 32) * _scale;
+						region->_sequence = sequence;
+
+						color = Json::getString(attachmentMap, "color", 0);
+						if (color) toColor(region->getColor(), color, true);
+
+						if (region->_region != NULL) region->updateRegion();
+						_attachmentLoader->configureAttachment(region);
+						break;
+					}
+					case AttachmentType_Mesh:
+					case AttachmentType_Linkedmesh: {
+						Sequence *sequence = readSequence(Json::getItem(attachmentMap, "sequence"));
+						attachment = _attachmentLoader->newMeshAttachment(*skin, attachmentName, attachmentPath, sequence);
+
+						if (!attachment) {
+							setError(NULL, "Error reading attachment: ", skinAttachmentName);
+							return false;
+						}
+
+						MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+						mesh->_path = attachmentPath;
+
+						color = Json::getString(attachmentMap, "color", 0);
+						if (color) toColor(mesh->getColor(), color, true);
+
+						mesh->_width = Json::getFloat(attachmentMap, "width", 32) * _scale;
+						mesh->_height = Json::getFloat(attachmentMap, "height", 32) * _scale;
+						mesh->_sequence = sequence;
+
+						entry = Json::getItem(attachmentMap, "parent");
+						if (!entry) {
+							int verticesLength;
+							entry = Json::getItem(attachmentMap, "triangles");
+							mesh->_triangles.ensureCapacity(entry->_size);
+							mesh->_triangles.setSize(entry->_size, 0);
+							for (entry = entry->_child, ii = 0; entry; entry = entry->_next, ++ii)
+								mesh->_triangles[ii] = (unsigned short) entry->_valueInt;
+
+							entry = Json::getItem(attachmentMap, "uvs");
+							verticesLength = entry->_size;
+							mesh->_regionUVs.ensureCapacity(verticesLength);
+							mesh->_regionUVs.setSize(verticesLength, 0);
+							for (entry = entry->_child, ii = 0; entry; entry = entry->_next, ++ii)
+								mesh->_regionUVs[ii] = entry->_valueFloat;
+
+							readVertices(attachmentMap, mesh, verticesLength);
+							mesh->packWeights();
+
+							if (mesh->_region != NULL) mesh->updateRegion();
+
+							mesh->_hullLength = Json::getInt(attachmentMap, "hull", 0);
+
+							entry = Json::getItem(attachmentMap, "edges");
+							if (entry) {
+								mesh->_edges.ensureCapacity(entry->_size);
+								mesh->_edges.setSize(entry->_size, 0);
+								for (entry = entry->_child, ii = 0; entry; entry = entry->_next, ++ii)
+									mesh->_edges[ii] = entry->_valueInt;
+							}
+							_attachmentLoader->configureAttachment(mesh);
+						} else {
+							bool inheritTimelines = Json::getInt(attachmentMap, "timelines", 1) ? true : false;
+							LinkedMesh *linkedMesh = new (__FILE__, __LINE__) LinkedMesh(mesh,
+																						 String(Json::getString(
+																								 attachmentMap,
+																								 "skin", 0)),
+																						 slot->getIndex(),
+																						 String(entry->_valueString),
+																						 inheritTimelines);
+							_linkedMeshes.add(linkedMesh);
+						}
+						break;
+					}
+					case AttachmentType_Boundingbox: {
+						attachment = _attachmentLoader->newBoundingBoxAttachment(*skin, attachmentName);
+
+						BoundingBoxAttachment *box = static_cast<BoundingBoxAttachment *>(attachment);
+
+						int vertexCount = Json::getInt(attachmentMap, "vertexCount", 0) << 1;
+						readVertices(attachmentMap, box, vertexCount);
+						color = Json::getString(attachmentMap, "color", NULL);
+						if (color) toColor(box->getColor(), color, true);
+						_attachmentLoader->configureAttachment(attachment);
+						break;
+					}
+					case AttachmentType_Path: {
+						attachment = _attachmentLoader->newPathAttachment(*skin, attachmentName);
+
+						PathAttachment *pathAttatchment = static_cast<PathAttachment *>(attachment);
+
+						int vertexCount = 0;
+						pathAttatchment->_closed = Json::getInt(attachmentMap, "closed", 0) ? true : false;
+						pathAttatchment->_constantSpeed = Json::getInt(attachmentMap, "constantSpeed", 1) ? true
+																										  : false;
+						vertexCount = Json::getInt(attachmentMap, "vertexCount", 0);
+						readVertices(attachmentMap, pathAttatchment, vertexCount << 1);
+
+						pathAttatchment->_lengths.ensureCapacity(vertexCount / 3);
+						pathAttatchment->_lengths.setSize(vertexCount / 3, 0);
+
+						curves = Json::getItem(attachmentMap, "lengths");
+						for (curves = curves->_child, ii = 0; curves; curves = curves->_next, ++ii)
+							pathAttatchment->_lengths[ii] = curves->_valueFloat * _scale;
+						color = Json::getString(attachmentMap, "color", NULL);
+						if (color) toColor(pathAttatchment->getColor(), color, true);
+						_attachmentLoader->configureAttachment(attachment);
+						break;
+					}
+					case AttachmentType_Point: {
+						attachment = _attachmentLoader->newPointAttachment(*skin, attachmentName);
+
+						PointAttachment *point = static_cast<PointAttachment *>(attachment);
+
+						point->_x = Json::getFloat(attachmentMap, "x", 0) * _scale;
+						point->_y = Json::getFloat(attachmentMap, "y", 0) * _scale;
+						point->_rotation = Json::getFloat(attachmentMap, "rotation", 0);
+						color = Json::getString(attachmentMap, "color", NULL);
+						if (color) toColor(point->getColor(), color, true);
+						_attachmentLoader->configureAttachment(attachment);
+						break;
+					}
+					case AttachmentType_Clipping: {
+						attachment = _attachmentLoader->newClippingAttachment(*skin, attachmentName);
+
+						ClippingAttachment *clip = static_cast<ClippingAttachment *>(attachment);
+
+						int vertexCount = 0;
+						const char *end = Json::getString(attachmentMap, "end", 0);
+						if (end) clip->_endSlot = skeletonData->findSlot(end);
+						vertexCount = Json::getInt(attachmentMap, "vertexCount", 0) << 1;
+						readVertices(attachmentMap, clip, vertexCount);
+						color = Json::getString(attachmentMap, "color", NULL);
+						if (color) toColor(clip->getColor(), color, true);
+						_attachmentLoader->configureAttachment(attachment);
+						break;
+					}
+				}
+
+				skin->setAttachment(slot->getIndex(), skinAttachmentName, attachment);
+			}
+		}
+	return true;
+}
+
 Sequence *SkeletonJson::readSequence(Json *item) {
 	if (item == NULL) return NULL;
 	Sequence *sequence = new Sequence(Json::getInt(item, "count", 0));
@@ -35,10 +35,67 @@
 #include <spine/MeshAttachment.h>
 #include <spine/ClippingAttachment.h>
 #include <spine/Bone.h>
+#include <spine/ContainerUtil.h>
 
 using namespace spine;
 
-SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quadIndices(), _clipping(), _renderCommands() {
+VertexLayout::VertexLayout() : stride(sizeof(float) * 4 + sizeof(uint32_t) * 2), positionOffset(0), uvOffset(sizeof(float) * 2),
+							   colorOffset(sizeof(float) * 4), darkColorOffset(sizeof(float) * 4 + sizeof(uint32_t)),
+							   colorFormat(VertexColorFormat_ARGB) {
+}
+
+namespace spine {
+	class RetainedSlot : public SpineObject {
+	public:
+		RetainedSlot() : attachment(NULL), sequenceIndex(0), color(0), darkColor(0), blendMode(BlendMode_Normal), valid(false) {
+			command.indices32 = NULL;
+			command.vertices = NULL;
+			command.next = NULL;
+		}
+
+		Attachment *attachment;
+		int sequenceIndex;
+		uint32_t color, darkColor;
+		BlendMode blendMode;
+		Vector<float> bones;
+		Vector<float> deform;
+		bool valid;
+		RenderCommand command;
+		Vector<float> positions;
+		Vector<float> uvs;
+		Vector<uint32_t> colors;
+		Vector<uint32_t> darkColors;
+		Vector<uint16_t> indices;
+		Vector<uint32_t> indices32;
+
+		void setSize(int32_t numVertices, int32_t numIndices, bool use32BitIndices) {
+			positions.setSize(numVertices << 1, 0);
+			uvs.setSize(numVertices << 1, 0);
+			colors.setSize(numVertices, 0);
+			darkColors.setSize(numVertices, 0);
+			if (use32BitIndices)
+				indices32.setSize(numIndices, 0);
+			else
+				indices.setSize(numIndices, 0);
+			command.positions = positions.buffer();
+			command.uvs = uvs.buffer();
+			command.colors = colors.buffer();
+			command.darkColors = darkColors.buffer();
+			command.numVertices = numVertices;
+			command.indices = use32BitIndices ? NULL : indices.buffer();
+			command.indices32 = use32BitIndices ? indices32.buffer() : NULL;
+			command.numIndices = numIndices;
+		}
+	};
+
+	class RetainedBatch : public RetainedSlot {
+	public:
+		Vector<RenderCommand *> commands;
+	};
+}
+
+SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quadIndices(), _clipping(), _renderCommands(),
+									   _numVertices(0), _use32BitIndices(false), _retained(false), _retainedSkeleton(NULL) {
 	_quadIndices.add(0);
 	_quadIndices.add(1);
 	_quadIndices.add(2);
@@ -48,96 +105,181 @@ SkeletonRenderer::SkeletonRenderer() : _allocator(4096), _worldVertices(), _quad
 }
 
 SkeletonRenderer::~SkeletonRenderer() {
+	invalidate();
 }
 
-static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVertices, int32_t numIndices, BlendMode blendMode, void *texture) {
+void SkeletonRenderer::setUse32BitIndices(bool use32BitIndices) {
+	_use32BitIndices = use32BitIndices;
+	invalidate();
+}
+
+bool SkeletonRenderer::getUse32BitIndices() {
+	return _use32BitIndices;
+}
+
+void SkeletonRenderer::setRetained(bool retained) {
+	_retained = retained;
+	if (!retained) invalidate();
+}
+
+bool SkeletonRenderer::getRetained() {
+	return _retained;
+}
+
+void SkeletonRenderer::invalidate() {
+	ContainerUtil::cleanUpVectorOfPointers(_retainedSlots);
+	ContainerUtil::cleanUpVectorOfPointers(_retainedBatches);
+	_retainedSkeleton = NULL;
+}
+
+static RenderCommand *createRenderCommand(BlockAllocator &allocator, int numVertices, int32_t numIndices, BlendMode blendMode, void *texture, bool use32BitIndices) {
 	RenderCommand *cmd = allocator.allocate<RenderCommand>(1);
 	cmd->positions = allocator.allocate<float>(numVertices << 1);
 	cmd->uvs = allocator.allocate<float>(numVertices << 1);
 	cmd->colors = allocator.allocate<uint32_t>(numVertices);
 	cmd->darkColors = allocator.allocate<uint32_t>(numVertices);
 	cmd->numVertices = numVertices;
-	cmd->indices = allocator.allocate<uint16_t>(numIndices);
+	cmd->indices = use32BitIndices ? nullptr : allocator.allocate<uint16_t>(numIndices);
+	cmd->indices32 = use32BitIndices ? allocator.allocate<uint32_t>(numIndices) : nullptr;
 	cmd->numIndices = numIndices;
 	cmd->blendMode = blendMode;
 	cmd->texture = texture;
+	cmd->vertices = nullptr;
 	cmd->next = nullptr;
 	return cmd;
 }
 
-static RenderCommand *batchSubCommands(BlockAllocator &allocator, Vector<RenderCommand *> &commands, int first, int last, int numVertices, int numIndices) {
-	RenderCommand *batched = createRenderCommand(allocator, numVertices, numIndices, commands[first]->blendMode, commands[first]->texture);
+/// Copies the indices of a command, offset by the index of its first vertex in the batch.
+static void copyIndices(RenderCommand *batched, RenderCommand *cmd, int32_t indicesOffset, int32_t verticesOffset) {
+	if (batched->indices32) {
+		uint32_t *indices = batched->indices32 + indicesOffset;
+		for (int ii = 0; ii < cmd->numIndices; ii++)
+			indices[ii] = cmd->indices[ii] + verticesOffset;
+	} else {
+		uint16_t *indices = batched->indices + indicesOffset;
+		for (int ii = 0; ii < cmd->numIndices; ii++)
+			indices[ii] = cmd->indices[ii] + verticesOffset;
+	}
+}
+
+static void copySubCommands(RenderCommand *batched, Vector<RenderCommand *> &commands, int first, int last) {
 	float *positions = batched->positions;
 	float *uvs = batched->uvs;
 	uint32_t *colors = batched->colors;
 	uint32_t *darkColors = batched->darkColors;
-	uint16_t *indices = batched->indices;
+	int verticesOffset = 0;
 	int indicesOffset = 0;
 	for (int i = first; i <= last; i++) {
 		RenderCommand *cmd = commands[i];
+		if (cmd->numVertices == 0 && cmd->numIndices == 0) continue;
 		memcpy(positions, cmd->positions, sizeof(float) * 2 * cmd->numVertices);
 		memcpy(uvs, cmd->uvs, sizeof(float) * 2 * cmd->numVertices);
 		memcpy(colors, cmd->colors, sizeof(int32_t) * cmd->numVertices);
 		memcpy(darkColors, cmd->darkColors, sizeof(int32_t) * cmd->numVertices);
-		for (int ii = 0; ii < cmd->numIndices; ii++)
-			indices[ii] = cmd->indices[ii] + indicesOffset;
-		indicesOffset += cmd->numVertices;
+		copyIndices(batched, cmd, indicesOffset, verticesOffset);
+		verticesOffset += cmd->numVertices;
+		indicesOffset += cmd->numIndices;
 		positions += 2 * cmd->numVertices;
 		uvs += 2 * cmd->numVertices;
 		colors += cmd->numVertices;
 		darkColors += cmd->numVertices;
-		indices += cmd->numIndices;
 	}
+}
+
+static RenderCommand *batchSubCommands(BlockAllocator &allocator, Vector<RenderCommand *> &commands, int first, int last, int numVertices, int numIndices, bool use32BitIndices) {
+	RenderCommand *batched = createRenderCommand(allocator, numVertices, numIndices, commands[first]->blendMode, commands[first]->texture, use32BitIndices);
+	copySubCommands(batched, commands, first, last);
 	return batched;
 }
 
-static RenderCommand *batchCommands(BlockAllocator &allocator, Vector<RenderCommand *> &commands) {
-	if (commands.size() == 0) return nullptr;
+/// Colors are per vertex, so only the texture, blend mode and, for 16 bit indices, the number of indices break a batch.
+static bool canBatch(RenderCommand *first, RenderCommand *cmd, int numIndices, bool use32BitIndices) {
+	return cmd->texture == first->texture &&
+		   cmd->blendMode == first->blendMode &&
+		   (use32BitIndices || numIndices + cmd->numIndices < 0xffff);
+}
+
+/// Returns the index after the last command which can be batched with the command at start, skipping empty commands.
+static int findBatchEnd(Vector<RenderCommand *> &commands, int start, int &numVertices, int &numIndices, bool use32BitIndices) {
+	RenderCommand *first = commands[start];
+	numVertices = first->numVertices;
+	numIndices = first->numIndices;
+	int end = start + 1;
+	for (int n = (int) commands.size(); end < n; end++) {
+		RenderCommand *cmd = commands[end];
+		if (cmd->numVertices == 0 && cmd->numIndices == 0) continue;
+		if (!canBatch(first, cmd, numIndices, use32BitIndices)) break;
+		numVertices += cmd->numVertices;
+		numIndices += cmd->numIndices;
+	}
+	return end;
+}
 
+static RenderCommand *batchCommands(BlockAllocator &allocator, Vector<RenderCommand *> &commands, bool use32BitIndices) {
 	RenderCommand *root = nullptr;
 	RenderCommand *last = nullptr;
-
-	RenderCommand *first = commands[0];
-	int startIndex = 0;
-	int i = 1;
-	int numVertices = first->numVertices;
-	int numIndices = first->numIndices;
-	while (i <= (int) commands.size()) {
-		RenderCommand *cmd = i < (int) commands.size() ? commands[i] : nullptr;
-
-		if (cmd && cmd->numVertices == 0 && cmd->numIndices == 0) {
-			i++;
-			continue;
-		}
-
-		if (cmd != nullptr && cmd->texture == first->texture &&
-			cmd->blendMode == first->blendMode &&
-			cmd->colors[0] == first->colors[0] &&
-			cmd->darkColors[0] == first->darkColors[0] &&
-			numIndices + cmd->numIndices < 0xffff) {
-			numVertices += cmd->numVertices;
-			numIndices += cmd->numIndices;
+	for (int start = 0, n = (int) commands.size(); start < n;) {
+		int numVertices, numIndices;
+		int end = findBatchEnd(commands, start, numVertices, numIndices, use32BitIndices);
+		RenderCommand *batched = batchSubCommands(allocator, commands, start, end - 1, numVertices, numIndices, use32BitIndices);
+		if (!last) {
+			root = last = batched;
 		} else {
-			RenderCommand *batched = batchSubCommands(allocator, commands, startIndex, i - 1, numVertices, numIndices);
-			if (!last) {
-				root = last = batched;
-			} else {
-				last->next = batched;
-				last = batched;
-			}
-			if (i == (int) commands.size()) break;
-			first = commands[i];
-			startIndex = i;
-			numVertices = first->numVertices;
-			numIndices = first->numIndices;
+			last->next = batched;
+			last = batched;
 		}
-		i++;
+		start = end;
 	}
 	return root;
 }
 
+static void computeColors(Skeleton &skeleton, Slot &slot, Color &attachmentColor, uint32_t &color, uint32_t &darkColor) {
+	uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor.r * 255);
+	uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor.g * 255);
+	uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor.b * 255);
+	uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor.a * 255);
+	color = (a << 24) | (r << 16) | (g << 8) | b;
+	darkColor = 0xff000000;
+	if (slot.hasDarkColor()) {
+		Color &slotDarkColor = slot.getDarkColor();
+		darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
+	}
+}
+
 RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 	_allocator.compress();
+	if (_retained) {
+		computeRetainedCommands(skeleton);
+		return batchRetainedCommands();
+	}
+	computeCommands(skeleton);
+	return batchCommands(_allocator, _renderCommands, _use32BitIndices);
+}
+
+RenderCommand *SkeletonRenderer::render(Skeleton &skeleton, const VertexLayout &layout, void *vertices, int32_t maxVertices) {
+	_allocator.compress();
+	if (_retained)
+		computeRetainedCommands(skeleton);
+	else
+		computeCommands(skeleton);
+
+	_numVertices = 0;
+	for (size_t i = 0, n = _renderCommands.size(); i < n; i++)
+		_numVertices += _renderCommands[i]->numVertices;
+	if (_numVertices > maxVertices) return nullptr;
+	return batchInterleavedCommands(layout, (uint8_t *) vertices);
+}
+
+int32_t SkeletonRenderer::getNumVertices() {
+	return _numVertices;
+}
+
+RenderCommand *SkeletonRenderer::writeCommands(const VertexLayout &layout, void *vertices, int32_t maxVertices) {
+	if (_numVertices > maxVertices) return nullptr;
+	return batchInterleavedCommands(layout, (uint8_t *) vertices);
+}
+
+void SkeletonRenderer::computeCommands(Skeleton &skeleton) {
 	_renderCommands.clear();
 
 	SkeletonClipping &clipper = _clipping;
@@ -209,16 +351,8 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 		} else
 			continue;
 
-		uint8_t r = static_cast<uint8_t>(skeleton.getColor().r * slot.getColor().r * attachmentColor->r * 255);
-		uint8_t g = static_cast<uint8_t>(skeleton.getColor().g * slot.getColor().g * attachmentColor->g * 255);
-		uint8_t b = static_cast<uint8_t>(skeleton.getColor().b * slot.getColor().b * attachmentColor->b * 255);
-		uint8_t a = static_cast<uint8_t>(skeleton.getColor().a * slot.getColor().a * attachmentColor->a * 255);
-		uint32_t color = (a << 24) | (r << 16) | (g << 8) | b;
-		uint32_t darkColor = 0xff000000;
-		if (slot.hasDarkColor()) {
-			Color &slotDarkColor = slot.getDarkColor();
-			darkColor = 0xff000000 | (static_cast<uint8_t>(slotDarkColor.r * 255) << 16) | (static_cast<uint8_t>(slotDarkColor.g * 255) << 8) | static_cast<uint8_t>(slotDarkColor.b * 255);
-		}
+		uint32_t color, darkColor;
+		computeColors(skeleton, slot, *attachmentColor, color, darkColor);
 
 		if (clipper.isClipping()) {
 			clipper.clipTriangles(*worldVertices, *indices, *uvs, 2);
@@ -229,7 +363,7 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 			indicesCount = (int32_t) (clipper.getClippedTriangles().size());
 		}
 
-		RenderCommand *cmd = createRenderCommand(_allocator, verticesCount, indicesCount, slot.getData().getBlendMode(), texture);
+		RenderCommand *cmd = createRenderCommand(_allocator, verticesCount, indicesCount, slot.getData().getBlendMode(), texture, false);
 		_renderCommands.add(cmd);
 		memcpy(cmd->positions, vertices->buffer(), (verticesCount << 1) * sizeof(float));
 		memcpy(cmd->uvs, uvs->buffer(), (verticesCount << 1) * sizeof(float));
@@ -241,6 +375,283 @@ RenderCommand *SkeletonRenderer::render(Skeleton &skeleton) {
 		clipper.clipEnd(slot);
 	}
 	clipper.clipEnd();
+}
 
-	return batchCommands(_allocator, _renderCommands);
-}
\ No newline at end of file
+static bool updateBone(float *values, Bone *bone) {
+	if (values[0] == bone->getA() && values[1] == bone->getB() && values[2] == bone->getC() &&
+		values[3] == bone->getD() && values[4] == bone->getWorldX() && values[5] == bone->getWorldY())
+		return false;
+	values[0] = bone->getA();
+	values[1] = bone->getB();
+	values[2] = bone->getC();
+	values[3] = bone->getD();
+	values[4] = bone->getWorldX();
+	values[5] = bone->getWorldY();
+	return true;
+}
+
+/// Stores the world transforms of the bones which affect the attachment's vertices. Returns true if any changed.
+bool SkeletonRenderer::updateBones(Vector<float> &bones, Slot &slot, Attachment *attachment) {
+	Vector<int> *weightBones = NULL;
+	if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+		MeshAttachment *mesh = (MeshAttachment *) attachment;
+		if (mesh->getBones().size() > 0) weightBones = mesh->_weightBones.size() > 0 ? &mesh->_weightBones : &mesh->getBones();
+	}
+	if (!weightBones) {
+		bool changed = bones.size() != 6;
+		if (changed) bones.setSize(6, 0);
+		return updateBone(bones.buffer(), &slot.getBone()) || changed;
+	}
+
+	Vector<Bone *> &skeletonBones = slot.getBone().getSkeleton().getBones();
+	bool changed = bones.size() != weightBones->size() * 6;
+	if (changed) bones.setSize(weightBones->size() * 6, 0);
+	float *values = bones.buffer();
+	if (weightBones == &((MeshAttachment *) attachment)->_weightBones) {
+		for (size_t i = 0, n = weightBones->size(); i < n; i++, values += 6)
+			if (updateBone(values, skeletonBones[(*weightBones)[i]])) changed = true;
+	} else {
+		// Unpacked weights store the bone count for each vertex followed by the bone indices.
+		for (size_t v = 0, n = weightBones->size(); v < n;) {
+			int count = (*weightBones)[v++];
+			values += 6;
+			for (int ii = 0; ii < count; ii++, v++, values += 6)
+				if (updateBone(values, skeletonBones[(*weightBones)[v]])) changed = true;
+		}
+	}
+	return changed;
+}
+
+static bool updateDeform(Vector<float> &deform, Vector<float> &slotDeform) {
+	if (deform.size() == slotDeform.size() &&
+		(deform.size() == 0 || memcmp(deform.buffer(), slotDeform.buffer(), deform.size() * sizeof(float)) == 0))
+		return false;
+	deform.clearAndAddAll(slotDeform);
+	return true;
+}
+
+void SkeletonRenderer::computeRetainedCommands(Skeleton &skeleton) {
+	if (_retainedSkeleton != &skeleton || _retainedSlots.size() != skeleton.getSlots().size()) {
+		invalidate();
+		_retainedSkeleton = &skeleton;
+		for (size_t i = 0, n = skeleton.getSlots().size(); i < n; i++)
+			_retainedSlots.add(new (__FILE__, __LINE__) RetainedSlot());
+	}
+	_renderCommands.clear();
+	_dirtyCommands.clear();
+
+	SkeletonClipping &clipper = _clipping;
+
+	for (unsigned i = 0; i < skeleton.getSlots().size(); ++i) {
+		Slot &slot = *skeleton.getDrawOrder()[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment) {
+			clipper.clipEnd(slot);
+			continue;
+		}
+
+		// Early out if the slot color is 0 or the bone is not active
+		if ((slot.getColor().a == 0 || !slot.getBone().isActive()) && !attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+			clipper.clipEnd(slot);
+			continue;
+		}
+
+		Color *attachmentColor;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti))
+			attachmentColor = &((RegionAttachment *) attachment)->getColor();
+		else if (attachment->getRTTI().isExactly(MeshAttachment::rtti))
+			attachmentColor = &((MeshAttachment *) attachment)->getColor();
+		else {
+			if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) clipper.clipStart(slot, (ClippingAttachment *) attachment);
+			continue;
+		}
+
+		// Early out if the slot color is 0
+		if (attachmentColor->a == 0) {
+			clipper.clipEnd(slot);
+			continue;
+		}
+
+		uint32_t color, darkColor;
+		computeColors(skeleton, slot, *attachmentColor, color, darkColor);
+		BlendMode blendMode = slot.getData().getBlendMode();
+
+		RetainedSlot &retained = *_retainedSlots[slot.getData().getIndex()];
+		bool dirty = !retained.valid || clipper.isClipping();
+		if (retained.attachment != attachment || retained.sequenceIndex != slot.getSequenceIndex() ||
+			retained.color != color || retained.darkColor != darkColor || retained.blendMode != blendMode) {
+			retained.attachment = attachment;
+			retained.sequenceIndex = slot.getSequenceIndex();
+			retained.color = color;
+			retained.darkColor = darkColor;
+			retained.blendMode = blendMode;
+			dirty = true;
+		}
+		if (updateBones(retained.bones, slot, attachment)) dirty = true;
+		if (updateDeform(retained.deform, slot.getDeform())) dirty = true;
+
+		if (dirty) {
+			Vector<float> *vertices = &_worldVertices;
+			int32_t verticesCount;
+			Vector<float> *uvs;
+			Vector<unsigned short> *indices;
+			void *texture;
+			if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+				RegionAttachment *regionAttachment = (RegionAttachment *) attachment;
+				_worldVertices.setSize(8, 0);
+				regionAttachment->computeWorldVertices(slot, _worldVertices, 0, 2);
+				verticesCount = 4;
+				uvs = &regionAttachment->getUVs();
+				indices = &_quadIndices;
+				texture = regionAttachment->getRegion()->rendererObject;
+			} else {
+				MeshAttachment *mesh = (MeshAttachment *) attachment;
+				_worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+				mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), _worldVertices.buffer(), 0, 2);
+				verticesCount = (int32_t) (mesh->getWorldVerticesLength() >> 1);
+				uvs = &mesh->getUVs();
+				indices = &mesh->getTriangles();
+				texture = mesh->getRegion()->rendererObject;
+			}
+
+			if (clipper.isClipping()) {
+				clipper.clipTriangles(_worldVertices, *indices, *uvs, 2);
+				vertices = &clipper.getClippedVertices();
+				verticesCount = (int32_t) (clipper.getClippedVertices().size() >> 1);
+				uvs = &clipper.getClippedUVs();
+				indices = &clipper.getClippedTriangles();
+			}
+
+			retained.setSize(verticesCount, (int32_t) indices->size(), false);
+			RenderCommand &cmd = retained.command;
+			cmd.blendMode = blendMode;
+			cmd.texture = texture;
+			if (verticesCount == 0) {
+				cmd.numIndices = 0;
+				retained.valid = false;
+				_renderCommands.add(&cmd);
+				_dirtyCommands.add(true);
+				clipper.clipEnd(slot);
+				continue;
+			}
+			memcpy(cmd.positions, vertices->buffer(), (verticesCount << 1) * sizeof(float));
+			memcpy(cmd.uvs, uvs->buffer(), (verticesCount << 1) * sizeof(float));
+			for (int ii = 0; ii < verticesCount; ii++) {
+				cmd.colors[ii] = color;
+				cmd.darkColors[ii] = darkColor;
+			}
+			memcpy(cmd.indices, indices->buffer(), indices->size() * sizeof(uint16_t));
+			// Vertices computed while clipping depend on the clipping attachment, so they are never reused.
+			retained.valid = !clipper.isClipping();
+		}
+		_renderCommands.add(&retained.command);
+		_dirtyCommands.add(dirty);
+		clipper.clipEnd(slot);
+	}
+	clipper.clipEnd();
+}
+
+RenderCommand *SkeletonRenderer::batchRetainedCommands() {
+	RenderCommand *root = nullptr;
+	RenderCommand *last = nullptr;
+	size_t batchCount = 0;
+	for (int start = 0, n = (int) _renderCommands.size(); start < n;) {
+		RenderCommand *first = _renderCommands[start];
+		int numVertices, numIndices;
+		int end = findBatchEnd(_renderCommands, start, numVertices, numIndices, _use32BitIndices);
+		bool dirty = _dirtyCommands[start];
+
+		RenderCommand *batched;
+		if (end - start == 1 && !_use32BitIndices) {
+			// A single command is returned without copying.
+			batched = first;
+		} else {
+			if (batchCount == _retainedBatches.size()) _retainedBatches.add(new (__FILE__, __LINE__) RetainedBatch());
+			RetainedBatch &batch = *_retainedBatches[batchCount++];
+			if (batch.commands.size() != (size_t) (end - start)) dirty = true;
+			for (int i = start; i < end && !dirty; i++) {
+				if (_dirtyCommands[i] || batch.commands[i - start] != _renderCommands[i]) dirty = true;
+			}
+			if (dirty) {
+				batch.commands.clear();
+				for (int i = start; i < end; i++)
+					batch.commands.add(_renderCommands[i]);
+				batch.setSize(numVertices, numIndices, _use32BitIndices);
+				batch.command.blendMode = first->blendMode;
+				batch.command.texture = first->texture;
+				copySubCommands(&batch.command, _renderCommands, start, end - 1);
+			}
+			batched = &batch.command;
+		}
+
+		batched->next = nullptr;
+		if (!last)
+			root = last = batched;
+		else {
+			last->next = batched;
+			last = batched;
+		}
+		start = end;
+	}
+	return root;
+}
+
+static void writeVertices(RenderCommand *cmd, const VertexLayout &layout, uint8_t *vertices) {
+	for (int i = 0; i < cmd->numVertices; i++, vertices += layout.stride) {
+		memcpy(vertices + layout.positionOffset, cmd->positions + (i << 1), sizeof(float) * 2);
+		if (layout.uvOffset >= 0) memcpy(vertices + layout.uvOffset, cmd->uvs + (i << 1), sizeof(float) * 2);
+		uint32_t color = cmd->colors[i];
+		uint32_t darkColor = cmd->darkColors[i];
+		if (layout.colorFormat == VertexColorFormat_ABGR) {
+			color = (color & 0xff00ff00) | ((color & 0x00ff0000) >> 16) | ((color & 0x000000ff) << 16);
+			darkColor = (darkColor & 0xff00ff00) | ((darkColor & 0x00ff0000) >> 16) | ((darkColor & 0x000000ff) << 16);
+		}
+		if (layout.colorOffset >= 0) memcpy(vertices + layout.colorOffset, &color, sizeof(uint32_t));
+		if (layout.darkColorOffset >= 0) memcpy(vertices + layout.darkColorOffset, &darkColor, sizeof(uint32_t));
+	}
+}
+
+RenderCommand *SkeletonRenderer::batchInterleavedCommands(const VertexLayout &layout, uint8_t *vertices) {
+	RenderCommand *root = nullptr;
+	RenderCommand *last = nullptr;
+	for (int start = 0, n = (int) _renderCommands.size(); start < n;) {
+		RenderCommand *first = _renderCommands[start];
+		int numVertices, numIndices;
+		int end = findBatchEnd(_renderCommands, start, numVertices, numIndices, _use32BitIndices);
+
+		RenderCommand *batched = _allocator.allocate<RenderCommand>(1);
+		batched->positions = nullptr;
+		batched->uvs = nullptr;
+		batched->colors = nullptr;
+		batched->darkColors = nullptr;
+		batched->numVertices = numVertices;
+		batched->indices = _use32BitIndices ? nullptr : _allocator.allocate<uint16_t>(numIndices);
+		batched->indices32 = _use32BitIndices ? _allocator.allocate<uint32_t>(numIndices) : nullptr;
+		batched->numIndices = numIndices;
+		batched->blendMode = first->blendMode;
+		batched->texture = first->texture;
+		batched->vertices = vertices;
+		batched->next = nullptr;
+
+		int verticesOffset = 0;
+		int indicesOffset = 0;
+		for (int i = start; i < end; i++) {
+			RenderCommand *cmd = _renderCommands[i];
+			if (cmd->numVertices == 0 && cmd->numIndices == 0) continue;
+			writeVertices(cmd, layout, vertices);
+			copyIndices(batched, cmd, indicesOffset, verticesOffset);
+			verticesOffset += cmd->numVertices;
+			indicesOffset += cmd->numIndices;
+			vertices += cmd->numVertices * layout.stride;
+		}
+
+		if (!last)
+			root = last = batched;
+		else {
+			last->next = batched;
+			last = batched;
+		}
+		start = end;
+	}
+	return root;
+}
@@ -32,6 +32,7 @@
 #include <spine/Attachment.h>
 #include <spine/MeshAttachment.h>
 #include <spine/Skeleton.h>
+#include <spine/SkeletonData.h>
 
 #include <spine/ConstraintData.h>
 #include <spine/Slot.h>
@@ -40,7 +41,7 @@
 
 using namespace spine;
 
-Skin::AttachmentMap::AttachmentMap() {
+Skin::AttachmentMap::AttachmentMap() : _handleData(NULL) {
 }
 
 static void disposeAttachment(Attachment *attachment) {
@@ -61,6 +62,7 @@ void Skin::AttachmentMap::put(size_t slotIndex, const String &attachmentName, At
 	} else {
 		bucket.add(Entry(slotIndex, attachmentName, attachment));
 	}
+	if (_handleData) setHandle(slotIndex, attachmentName, attachment);
 }
 
 Attachment *Skin::AttachmentMap::get(size_t slotIndex, const String &attachmentName) {
@@ -69,12 +71,20 @@ Attachment *Skin::AttachmentMap::get(size_t slotIndex, const String &attachmentN
 	return existing >= 0 ? _buckets[slotIndex][existing]._attachment : NULL;
 }
 
+Attachment *Skin::AttachmentMap::get(size_t slotIndex, SkeletonData &skeletonData, int attachmentHandle) {
+	if (_handleData != &skeletonData) return get(slotIndex, skeletonData.getAttachmentHandleName(slotIndex, attachmentHandle));
+	if (slotIndex >= _handles.size()) return NULL;
+	Vector<Attachment *> &handles = _handles[slotIndex];
+	return (size_t) attachmentHandle < handles.size() ? handles[attachmentHandle] : NULL;
+}
+
 void Skin::AttachmentMap::remove(size_t slotIndex, const String &attachmentName) {
 	if (slotIndex >= _buckets.size()) return;
 	int existing = findInBucket(_buckets[slotIndex], attachmentName);
 	if (existing >= 0) {
 		disposeAttachment(_buckets[slotIndex][existing]._attachment);
 		_buckets[slotIndex].removeAt(existing);
+		if (_handleData) setHandle(slotIndex, attachmentName, NULL);
 	}
 }
 
@@ -84,6 +94,25 @@ int Skin::AttachmentMap::findInBucket(Vector<Entry> &bucket, const String &attac
 	return -1;
 }
 
+void Skin::AttachmentMap::bind(SkeletonData &skeletonData) {
+	_handleData = &skeletonData;
+	_handles.clear();
+	for (size_t i = 0; i < _buckets.size(); i++) {
+		Vector<Entry> &bucket = _buckets[i];
+		for (size_t ii = 0; ii < bucket.size(); ii++)
+			setHandle(i, bucket[ii]._name, bucket[ii]._attachment);
+	}
+}
+
+void Skin::AttachmentMap::setHandle(size_t slotIndex, const String &attachmentName, Attachment *attachment) {
+	int handle = _handleData->addAttachmentHandle(slotIndex, attachmentName);
+	if (handle < 0) return;
+	if (slotIndex >= _handles.size()) _handles.setSize(slotIndex + 1, Vector<Attachment *>());
+	Vector<Attachment *> &handles = _handles[slotIndex];
+	if ((size_t) handle >= handles.size()) handles.setSize(handle + 1, NULL);
+	handles[handle] = attachment;
+}
+
 Skin::AttachmentMap::Entries Skin::AttachmentMap::getEntries() {
 	return Skin::AttachmentMap::Entries(_buckets);
 }
@@ -109,6 +138,14 @@ Attachment *Skin::getAttachment(size_t slotIndex, const String &name) {
 	return _attachments.get(slotIndex, name);
 }
 
+Attachment *Skin::getAttachment(size_t slotIndex, SkeletonData &skeletonData, int attachmentHandle) {
+	return _attachments.get(slotIndex, skeletonData, attachmentHandle);
+}
+
+void Skin::bindAttachmentHandles(SkeletonData &skeletonData) {
+	_attachments.bind(skeletonData);
+}
+
 void Skin::removeAttachment(size_t slotIndex, const String &name) {
 	_attachments.remove(slotIndex, name);
 }
@@ -40,6 +40,7 @@ SlotData::SlotData(int index, const String &name, BoneData &boneData) : _index(i
 																		_darkColor(0, 0, 0, 0),
 																		_hasDarkColor(false),
 																		_attachmentName(),
+																		_attachmentHandle(-1),
 																		_blendMode(BlendMode_Normal),
 																		_visible(true) {
 	assert(_index >= 0);
@@ -80,6 +81,11 @@ const String &SlotData::getAttachmentName() {
 
 void SlotData::setAttachmentName(const String &inValue) {
 	_attachmentName = inValue;
+	_attachmentHandle = -1;
+}
+
+int SlotData::getAttachmentHandle() {
+	return _attachmentHandle;
 }
 
 BlendMode SlotData::getBlendMode() {
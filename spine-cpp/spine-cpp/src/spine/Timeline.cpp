@@ -29,6 +29,7 @@
 
 #include <spine/Timeline.h>
 
+#include <spine/Animation.h>
 #include <spine/Event.h>
 #include <spine/Skeleton.h>
 
@@ -36,7 +37,7 @@ namespace spine {
 	RTTI_IMPL_NOPARENT(Timeline)
 
 	Timeline::Timeline(size_t frameCount, size_t frameEntries)
-		: _propertyIds(), _frames(), _frameEntries(frameEntries) {
+		: _propertyIds(), _propertySlots(), _frames(), _frameEntries(frameEntries), _searchCache(false), _frozen(false), _searchHint(-1) {
 		_frames.setSize(frameCount * frameEntries, 0);
 	}
 
@@ -47,6 +48,10 @@ namespace spine {
 		return _propertyIds;
 	}
 
+	Vector<int> &Timeline::getPropertySlots() {
+		return _propertySlots;
+	}
+
 	void Timeline::setPropertyIds(PropertyId propertyIds[], size_t propertyIdsCount) {
 		_propertyIds.clear();
 		_propertyIds.ensureCapacity(propertyIdsCount);
@@ -67,6 +72,25 @@ namespace spine {
 		return _frameEntries;
 	}
 
+	void Timeline::setSearchCache(bool searchCache) {
+		if (_frozen) return;
+		_searchCache = searchCache;
+		_searchHint = -1;
+	}
+
+	bool Timeline::getSearchCache() {
+		return _searchCache;
+	}
+
+	int Timeline::search(float time) {
+		return search(time, 1);
+	}
+
+	int Timeline::search(float time, size_t step) {
+		if (_searchCache) return Animation::search(_frames, time, (int) step, _searchHint);
+		return Animation::search(_frames, time, (int) step);
+	}
+
 	float Timeline::getDuration() {
 		return _frames[_frames.size() - getFrameEntries()];
 	}
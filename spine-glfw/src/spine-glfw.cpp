@@ -1,4 +1,5 @@
 #include "spine-glfw.h"
+#include <cstddef>
 #include <cstdio>
 #include <glbinding/gl/gl.h>
 #define STB_IMAGE_IMPLEMENTATION
@@ -290,32 +291,24 @@ void renderer_draw(renderer_t *renderer, Skeleton *skeleton, bool premultipliedA
 	shader_set_int(renderer->shader, "uTexture", 0);
 	glEnable(GL_BLEND);
 
-	RenderCommand *command = renderer->renderer->render(*skeleton);
+	VertexLayout layout;
+	layout.stride = sizeof(vertex_t);
+	layout.positionOffset = offsetof(vertex_t, x);
+	layout.uvOffset = offsetof(vertex_t, u);
+	layout.colorOffset = offsetof(vertex_t, color);
+	layout.darkColorOffset = offsetof(vertex_t, darkColor);
+	layout.colorFormat = VertexColorFormat_ABGR;
+
+	RenderCommand *command = renderer->renderer->render(*skeleton, layout, renderer->vertex_buffer, renderer->vertex_buffer_size);
+	if (!command && renderer->renderer->getNumVertices() > renderer->vertex_buffer_size) {
+		// Grow the buffer and write the commands that were already computed.
+		renderer->vertex_buffer_size = renderer->renderer->getNumVertices();
+		free(renderer->vertex_buffer);
+		renderer->vertex_buffer = (vertex_t *) malloc(sizeof(vertex_t) * renderer->vertex_buffer_size);
+		command = renderer->renderer->writeCommands(layout, renderer->vertex_buffer, renderer->vertex_buffer_size);
+	}
 	while (command) {
-		int num_command_vertices = command->numVertices;
-		if (renderer->vertex_buffer_size < num_command_vertices) {
-			renderer->vertex_buffer_size = num_command_vertices;
-			free(renderer->vertex_buffer);
-			renderer->vertex_buffer = (vertex_t *) malloc(sizeof(vertex_t) * renderer->vertex_buffer_size);
-		}
-		float *positions = command->positions;
-		float *uvs = command->uvs;
-		uint32_t *colors = command->colors;
-		uint32_t *darkColors = command->darkColors;
-		for (int i = 0, j = 0; i < num_command_vertices; i++, j += 2) {
-			vertex_t *vertex = &renderer->vertex_buffer[i];
-			vertex->x = positions[j];
-			vertex->y = positions[j + 1];
-			vertex->u = uvs[j];
-			vertex->v = uvs[j + 1];
-			uint32_t color = colors[i];
-			vertex->color = (color & 0xFF00FF00) | ((color & 0x00FF0000) >> 16) | ((color & 0x000000FF) << 16);
-			uint32_t darkColor = darkColors[i];
-			vertex->darkColor = (darkColor & 0xFF00FF00) | ((darkColor & 0x00FF0000) >> 16) | ((darkColor & 0x000000FF) << 16);
-		}
-		int num_command_indices = command->numIndices;
-		uint16_t *indices = command->indices;
-		mesh_update(renderer->mesh, renderer->vertex_buffer, num_command_vertices, indices, num_command_indices);
+		mesh_update(renderer->mesh, (vertex_t *) command->vertices, command->numVertices, command->indices, command->numIndices);
 
 		blend_mode_t blend_mode = blend_modes[command->blendMode];
 		glBlendFuncSeparate(premultipliedAlpha ? (GLenum) blend_mode.source_color_pma : (GLenum) blend_mode.source_color, (GLenum) blend_mode.dest_color, (GLenum) blend_mode.source_alpha, (GLenum) blend_mode.dest_color);
@@ -29,6 +29,7 @@
 
 #include "spine-sdl-cpp.h"
 #include <SDL.h>
+#include <stddef.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 
@@ -61,35 +62,28 @@ void SkeletonDrawable::update(float delta, Physics physics) {
 	skeleton->updateWorldTransform(physics);
 }
 
-inline void toSDLColor(uint32_t color, SDL_Color *sdlColor) {
-	sdlColor->a = (color >> 24) & 0xFF;
-	sdlColor->r = (color >> 16) & 0xFF;
-	sdlColor->g = (color >> 8) & 0xFF;
-	sdlColor->b = color & 0xFF;
-}
-
 void SkeletonDrawable::draw(SDL_Renderer *renderer) {
-	if (!skeletonRenderer) skeletonRenderer = new (__FILE__, __LINE__) SkeletonRenderer();
-	RenderCommand *command = skeletonRenderer->render(*skeleton);
-	while (command) {
-		float *positions = command->positions;
-		float *uvs = command->uvs;
-		uint32_t *colors = command->colors;
-		sdlVertices.clear();
-		for (int ii = 0; ii < command->numVertices << 1; ii += 2) {
-			SDL_Vertex sdlVertex;
-			sdlVertex.position.x = positions[ii];
-			sdlVertex.position.y = positions[ii + 1];
-			sdlVertex.tex_coord.x = uvs[ii];
-			sdlVertex.tex_coord.y = uvs[ii + 1];
-			toSDLColor(colors[ii >> 1], &sdlVertex.color);
-			sdlVertices.add(sdlVertex);
-		}
-		sdlIndices.clear();
-		uint16_t *indices = command->indices;
-		for (int ii = 0; ii < command->numIndices; ii++)
-			sdlIndices.add(indices[ii]);
+	if (!skeletonRenderer) {
+		skeletonRenderer = new (__FILE__, __LINE__) SkeletonRenderer();
+		// SDL_RenderGeometry() takes int indices.
+		skeletonRenderer->setUse32BitIndices(true);
+	}
 
+	VertexLayout layout;
+	layout.stride = sizeof(SDL_Vertex);
+	layout.positionOffset = offsetof(SDL_Vertex, position);
+	layout.uvOffset = offsetof(SDL_Vertex, tex_coord);
+	layout.colorOffset = offsetof(SDL_Vertex, color);
+	layout.darkColorOffset = -1;
+	layout.colorFormat = VertexColorFormat_ABGR;
+
+	RenderCommand *command = skeletonRenderer->render(*skeleton, layout, sdlVertices.buffer(), (int32_t) sdlVertices.size());
+	if (!command && skeletonRenderer->getNumVertices() > (int32_t) sdlVertices.size()) {
+		// Grow the buffer and write the commands that were already computed.
+		sdlVertices.setSize(skeletonRenderer->getNumVertices(), SDL_Vertex());
+		command = skeletonRenderer->writeCommands(layout, sdlVertices.buffer(), (int32_t) sdlVertices.size());
+	}
+	while (command) {
 		BlendMode blendMode = command->blendMode;
 		SDL_Texture *texture = (SDL_Texture *) command->texture;
 		if (!usePremultipliedAlpha) {
@@ -128,8 +122,8 @@ void SkeletonDrawable::draw(SDL_Renderer *renderer) {
 			}
 		}
 
-		SDL_RenderGeometry(renderer, texture, sdlVertices.buffer(), sdlVertices.size(), sdlIndices.buffer(),
-						   command->numIndices);
+		SDL_RenderGeometry(renderer, texture, (SDL_Vertex *) command->vertices, command->numVertices,
+						   (int *) command->indices32, command->numIndices);
 		command = command->next;
 	}
 }
@@ -51,7 +51,6 @@ namespace spine {
 	private:
 		bool ownsAnimationStateData;
 		Vector<SDL_Vertex> sdlVertices;
-		Vector<int> sdlIndices;
 	};
 
 	class SDLTextureLoader : public spine::TextureLoader {